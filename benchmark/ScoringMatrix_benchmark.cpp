@@ -0,0 +1,347 @@
+/**
+ * @file benchmark/ScoringMatrix_benchmark.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "ScoringMatrix.hpp"
+#include "MinPlus.hpp"
+
+#include <chrono>
+#include <numeric>
+
+
+
+#define BENCHMARK_DIAGONALS 16
+
+
+
+/**
+ * @brief Performs the bifurcations of Zuker::wm_decompose() on a number of diagonals of the matrix
+ *
+ * @return Checksum of the minima, to compare both variants
+ */
+double bifurcations(ScoringMatrix<float> &matrix, size_t n, size_t &elements)
+{
+	std::vector<float> buffer = std::vector<float>(n);
+	double checksum = 0.0;
+	
+	for(size_t diagonal = 1; diagonal <= BENCHMARK_DIAGONALS; diagonal++)
+	{
+		size_t d = diagonal * (n - 1) / BENCHMARK_DIAGONALS;
+		
+		for(size_t i = 0; i + d < n; i++)
+		{
+			size_t j = i + d;
+			size_t n_k = d - 1;
+			const float *column;
+			
+			if(matrix.has_transposed_copy())
+			{
+				column = matrix.column(j) + i + 2;
+			}
+			else
+			{
+				matrix.get_column(j, i + 2, j + 1, buffer.data());
+				column = buffer.data();
+			}
+			
+			float energy = N_INFINITY;
+			size_t argmin = 0;
+			MinPlus::reduce(matrix.row(i), column, n_k, energy, argmin);
+			
+			checksum += energy + (double) argmin;
+			elements += n_k;
+		}
+	}
+	
+	return checksum;
+}
+
+
+
+/**
+ * @brief Sums all rows, or all columns, of the matrix either by get() or through the spans
+ *
+ * @return Checksum of the values, to compare both variants
+ */
+double scan(ScoringMatrix<float> &matrix, size_t n, bool by_column, bool by_span, size_t &elements)
+{
+	double checksum = 0.0;
+	Pair p;
+	
+	for(size_t x = 0; x < n; x++)
+	{
+		float sum = 0.0f;
+		
+		if(by_column)
+		{
+			if(by_span)
+			{
+				ScoringMatrixSpan<float> column = matrix.column_span(x);
+				for(size_t i = 0; i <= x; i++)
+				{
+					sum += column[i];
+				}
+			}
+			else
+			{
+				for(p.first = 0, p.second = (unsigned int) x; p.first <= x; p.first++)
+				{
+					sum += matrix.get(p);
+				}
+			}
+			elements += x + 1;
+		}
+		else if(x + 1 < n)
+		{
+			if(by_span)
+			{
+				ScoringMatrixSpan<float> row = matrix.row_span(x);
+				for(size_t k = 0; k < row.length; k++)
+				{
+					sum += row[k];
+				}
+			}
+			else
+			{
+				for(p.first = (unsigned int) x, p.second = (unsigned int) x + 1; p.second < n; p.second++)
+				{
+					sum += matrix.get(p);
+				}
+			}
+			elements += n - x - 1;
+		}
+		
+		checksum += sum;
+	}
+	
+	return checksum;
+}
+
+
+
+/**
+ * @brief Fills a matrix in the order of Zuker::energy(), where every position depends on (i+1,j) and (i,j-1)
+ *
+ * @section DESCRIPTION
+ * The diagonals of tiles are divided over the threads; within a tile
+ * i goes down and j goes up. With a tile size of 1 the matrix is
+ * filled one diagonal at a time.
+ *
+ * @return Checksum of the matrix, to compare both layouts
+ */
+template <class Layout>
+double wavefront(size_t n, int threads, size_t tile_size, double &seconds)
+{
+	ScoringMatrix<float, Layout> matrix = ScoringMatrix<float, Layout>(n, 0.0f);
+	size_t n_tiles = (n + tile_size - 1) / tile_size;
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	#pragma omp parallel num_threads(threads)
+	{
+		for(size_t d = 0; d < n_tiles; d++)
+		{
+			#pragma omp for schedule(dynamic, 1)
+			for(size_t t = 0; t < n_tiles - d; t++)
+			{
+				size_t i_begin = t * tile_size;
+				size_t i_end = std::min(i_begin + tile_size, n);
+				size_t j_begin = (t + d) * tile_size;
+				size_t j_end = std::min(j_begin + tile_size, n);
+				
+				for(size_t i = i_end; i-- > i_begin;)
+				{
+					for(size_t j = std::max(j_begin, i + 1); j < j_end; j++)
+					{
+						Pair p = Pair((unsigned int) i, (unsigned int) j);
+						Pair p1 = Pair((unsigned int) i + 1, (unsigned int) j);
+						Pair p2 = Pair((unsigned int) i, (unsigned int) j - 1);
+						
+						matrix.set(p, std::min(matrix.get(p1), matrix.get(p2)) - 0.5f + (float)((i + 3 * j) % 7));
+					}
+				}
+			}
+		}
+	}
+	std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+	seconds = duration.count();
+	
+	double checksum = 0.0;
+	std::vector<float> column = std::vector<float>(n + 1);
+	for(size_t j = 0; j < n; j++)
+	{
+		matrix.get_column(j, 0, j + 1, column.data());
+		checksum += std::accumulate(column.begin(), column.begin() + (long)(j + 1), 0.0);
+	}
+	
+	return checksum;
+}
+
+
+
+/**
+ * @brief Compares the bifurcations of ScoringMatrix with and without its column-major copy
+ *
+ * @section DESCRIPTION
+ * For every size, both matrices are filled with set() and the
+ * bifurcations of a number of diagonals are reduced with the MinPlus
+ * kernel. The column operand is either copied out of the strided
+ * column or read in place from the column-major copy.
+ *
+ * Secondly, the rows and columns are scanned element by element, once
+ * with get() and once through row_span() and column_span().
+ *
+ * Finally, matrices in the row and the diagonal layout are filled in
+ * the order of Zuker::energy(), per diagonal (tile size 1) and per
+ * tile of 64, for a number of threads.
+ */
+int main(int argc, char *argv[])
+{
+	std::vector<size_t> sizes = {250, 500, 1000, 2000, 4000, 8000};
+	
+	printf("      n      set()  ns/cell      bifurcation  ns/element   memory  MB\n");
+	printf("              copy   no copy         copy   no copy        copy no copy\n");
+	
+	for(std::vector<size_t>::iterator n = sizes.begin(); n != sizes.end(); ++n)
+	{
+		double time_set[2];
+		double time_bifurcation[2];
+		double checksum[2];
+		size_t cells = 0;
+		size_t elements = 0;
+		
+		for(size_t transposed = 0; transposed < 2; transposed++)
+		{
+			ScoringMatrix<float> matrix = ScoringMatrix<float>(*n, N_INFINITY, transposed == 0);
+			
+			srand(1);
+			cells = 0;
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			for(size_t d = 1; d < *n; d++)
+			{
+				for(size_t i = 0; i + d < *n; i++)
+				{
+					Pair p = Pair((unsigned int) i, (unsigned int)(i + d));
+					matrix.set(p, (float)(rand() % 1000) * -0.1f);
+					cells++;
+				}
+			}
+			std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+			time_set[transposed] = duration.count();
+			
+			elements = 0;
+			start = std::chrono::steady_clock::now();
+			checksum[transposed] = bifurcations(matrix, *n, elements);
+			duration = std::chrono::steady_clock::now() - start;
+			time_bifurcation[transposed] = duration.count();
+		}
+		
+		double megabytes = (double)(cells * sizeof(float)) / (1024.0 * 1024.0);
+		
+		printf("%7zu  %8.2f  %8.2f     %8.3f  %8.3f    %8.1f %7.1f\n",
+			   *n,
+			   1e9 * time_set[0] / (double) cells, 1e9 * time_set[1] / (double) cells,
+			   1e9 * time_bifurcation[0] / (double) elements, 1e9 * time_bifurcation[1] / (double) elements,
+			   2.0 * megabytes, megabytes);
+		
+		if(checksum[0] != checksum[1])
+		{
+			fprintf(stderr, "Bifurcations with and without the column-major copy differ\n");
+			return EXIT_FAILURE;
+		}
+	}
+	
+	printf("\n      n      row scan  ns/element   column scan  ns/element\n");
+	printf("              get()      span        get()      span\n");
+	
+	for(std::vector<size_t>::iterator n = sizes.begin(); n != sizes.end(); ++n)
+	{
+		ScoringMatrix<float> matrix = ScoringMatrix<float>(*n, N_INFINITY, true);
+		
+		srand(1);
+		for(size_t d = 1; d < *n; d++)
+		{
+			for(size_t i = 0; i + d < *n; i++)
+			{
+				Pair p = Pair((unsigned int) i, (unsigned int)(i + d));
+				matrix.set(p, (float)(rand() % 1000) * -0.1f);
+			}
+		}
+		
+		double time_scan[4];
+		double checksum[4];
+		size_t elements = 0;
+		
+		for(size_t variant = 0; variant < 4; variant++)
+		{
+			elements = 0;
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			checksum[variant] = scan(matrix, *n, variant >= 2, variant % 2 == 1, elements);
+			std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+			time_scan[variant] = 1e9 * duration.count() / (double) elements;
+		}
+		
+		printf("%7zu  %8.3f  %8.3f     %8.3f  %8.3f\n", *n, time_scan[0], time_scan[1], time_scan[2], time_scan[3]);
+		
+		if(checksum[0] != checksum[1] || checksum[2] != checksum[3])
+		{
+			fprintf(stderr, "Scans with get() and through the spans differ\n");
+			return EXIT_FAILURE;
+		}
+	}
+	
+	std::vector<int> threads = {1, 2, 4};
+	std::vector<size_t> tile_sizes = {1, 64};
+	
+	printf("\n      n  threads   tile      fill  ns/cell\n");
+	printf("                              rows  diagonals\n");
+	
+	for(std::vector<size_t>::iterator n = sizes.begin(); n != sizes.end(); ++n)
+	{
+		for(std::vector<int>::iterator t = threads.begin(); t != threads.end(); ++t)
+		{
+			for(std::vector<size_t>::iterator tile_size = tile_sizes.begin(); tile_size != tile_sizes.end(); ++tile_size)
+			{
+				double seconds[2];
+				double checksum_rows = wavefront<ScoringMatrixRowLayout>(*n, *t, *tile_size, seconds[0]);
+				double checksum_diagonals = wavefront<ScoringMatrixDiagonalLayout>(*n, *t, *tile_size, seconds[1]);
+				double cells = (double)(((*n - 1) * *n) / 2);
+				
+				printf("%7zu  %7i  %5zu  %8.2f  %8.2f\n", *n, *t, *tile_size, 1e9 * seconds[0] / cells, 1e9 * seconds[1] / cells);
+				
+				if(checksum_rows != checksum_diagonals)
+				{
+					fprintf(stderr, "Fills in the row and the diagonal layout differ\n");
+					return EXIT_FAILURE;
+				}
+			}
+		}
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file benchmark/SegmentTree_benchmark.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "Direction.hpp"
+#include "Nucleotide.hpp"
+#include "Position.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+
+#include "ReadSegments.hpp"
+
+#include <chrono>
+
+
+
+#define BENCHMARK_QUERIES 4000000
+
+
+
+/**
+ * @brief Measures segment lookups per second of the pointer based tree (before) and the flat table of SegmentTree (after)
+ *
+ * @section DESCRIPTION
+ * The queries resemble those of Zuker::v(): pairs of arms of random
+ * length cut out of a random RNA, mixed with the arms of the segments
+ * themselves so that a part of the lookups is a hit.
+ */
+int main(int argc, char *argv[])
+{
+	std::string filename = (argc > 1) ? argv[1] : "share/segmentation-fold/segments.xml";
+	
+	SegmentTree segment_tree = SegmentTree();
+	SegmentLoopTree segmentloop_tree = SegmentLoopTree();
+	ReadSegments readsegments = ReadSegments(filename);
+	readsegments.parse(segment_tree, segmentloop_tree);
+	
+	std::vector<Segment *> segments;
+	segment_tree.get_segments(segments);
+	
+	if(segments.empty())
+	{
+		fprintf(stderr, "No segments found in: %s\n", filename.c_str());
+		return EXIT_FAILURE;
+	}
+	
+	SegmentTreeElement root = SegmentTreeElement(*segments[0]);
+	for(size_t i = 1; i < segments.size(); i++)
+	{
+		root.add_segment(*segments[i]);
+	}
+	
+	size_t max_size_5p = segment_tree.max_size(Direction::FivePrime);
+	size_t max_size_3p = segment_tree.max_size(Direction::ThreePrime);
+	
+	srand(1);
+	
+	Sequence rna = Sequence();
+	for(size_t i = 0; i < 4096; i++)
+	{
+		rna.push_back((Nucleotide)(rand() % 4));
+	}
+	
+	std::vector<SubSequence> queries_5p;
+	std::vector<SubSequence> queries_3p;
+	for(size_t i = 0; i < BENCHMARK_QUERIES; i++)
+	{
+		if(i % 4 == 0)
+		{
+			Segment *segment = segments[(size_t) rand() % segments.size()];
+			Sequence *sequence_5p = segment->get_sequence(Direction::FivePrime);
+			Sequence *sequence_3p = segment->get_sequence(Direction::ThreePrime);
+			
+			queries_5p.push_back(SubSequence(sequence_5p->data.begin(), sequence_5p->data.end() - 1));
+			queries_3p.push_back(SubSequence(sequence_3p->data.begin(), sequence_3p->data.end() - 1));
+		}
+		else
+		{
+			size_t size_5p = 1 + (size_t) rand() % max_size_5p;
+			size_t size_3p = 1 + (size_t) rand() % max_size_3p;
+			size_t start_5p = (size_t) rand() % (rna.size() - size_5p);
+			size_t start_3p = (size_t) rand() % (rna.size() - size_3p);
+			
+			queries_5p.push_back(rna.ssubseq(start_5p, start_5p + size_5p - 1));
+			queries_3p.push_back(rna.ssubseq(start_3p, start_3p + size_3p - 1));
+		}
+	}
+	
+	std::vector<Segment *> results_tree(BENCHMARK_QUERIES);
+	std::vector<Segment *> results_table(BENCHMARK_QUERIES);
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < BENCHMARK_QUERIES; i++)
+	{
+		results_tree[i] = root.search_segment(queries_5p[i], queries_3p[i]);
+	}
+	std::chrono::duration<double> time_tree = std::chrono::steady_clock::now() - start;
+	
+	start = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < BENCHMARK_QUERIES; i++)
+	{
+		results_table[i] = segment_tree.search(queries_5p[i], queries_3p[i]);
+	}
+	std::chrono::duration<double> time_table = std::chrono::steady_clock::now() - start;
+	
+	size_t hits = (size_t) std::count_if(results_table.begin(), results_table.end(), [](Segment *s) { return s != nullptr; });
+	
+	printf("segments:          %zu\n", segments.size());
+	printf("lookups:           %d (%zu hits)\n", BENCHMARK_QUERIES, hits);
+	printf("SegmentTreeElement: %.3g lookups/s\n", BENCHMARK_QUERIES / time_tree.count());
+	printf("SegmentTree:        %.3g lookups/s\n", BENCHMARK_QUERIES / time_table.count());
+	
+	if(results_tree != results_table)
+	{
+		fprintf(stderr, "Lookup results of the tree and the flat table differ\n");
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file benchmark/Zuker_benchmark.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "Region.hpp"
+#include "Nucleotide.hpp"
+#include "Pairing.hpp"
+#include "PairingPlus.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+
+#include "Direction.hpp"
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+#include "ReadSegments.hpp"
+
+#include "ScoringMatrix.hpp"
+#include "Settings.hpp"
+#include "DotBracket.hpp"
+#include "ReadData.hpp"
+
+#include "Zuker.hpp"
+
+#include <chrono>
+
+
+
+/**
+ * @brief Fills the matrices of one engine in energy only mode
+ *
+ * @return Gibbs free energy of the sequence in kcal/mol
+ */
+template <class Engine>
+float fill(Settings &settings, Sequence &sequence, ReadData &thermodynamics, double &seconds, double &megabytes)
+{
+	Engine zuker = Engine(settings, sequence, thermodynamics);
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	float energy = zuker.energy();
+	std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+	seconds = duration.count();
+	
+	// W and WM have a column-major copy
+	size_t elements = zuker.vij.size() + 2 * zuker.wij.size() + 2 * zuker.wmij.size();
+	megabytes = (double)(elements * sizeof(typename Engine::energy_type)) / (1024.0 * 1024.0);
+	
+	return energy;
+}
+
+
+
+/**
+ * @brief Compares the fill of the float engine (Zuker) with the fixed-point engine (FixedPointZuker)
+ *
+ * @section DESCRIPTION
+ * Random RNA sequences of increasing length are folded single-threaded
+ * in energy only mode, with a maximal loop length of 30, by both
+ * engines. The energies may only differ by rounding of the
+ * extrapolated loop energies.
+ *
+ * Secondly, the same sequences are folded without segments (-p 0), by
+ * the generic engine and by the engine the Scheduler selects for it:
+ * without the segment lookups and with a constant minimal hairpin
+ * length. Both must give the same energy.
+ */
+int main(int argc, char *argv[])
+{
+	std::vector<size_t> sizes = {250, 500, 1000, 2000};
+	
+	Sequence sequence = Sequence();
+	char *settings_argv[] = {(char *) PACKAGE_NAME, (char *) "-e", (char *) "-l", (char *) "30", (char *) "-t", (char *) "1", (char *) "-s", (char *) "a", nullptr};
+	signed int settings_argc = (signed int) sizeof(settings_argv) / (signed int) sizeof(char *) - 1;
+	Settings settings = Settings(settings_argc, settings_argv, sequence);
+	
+	ReadData thermodynamics = ReadData();
+	ReadSegments readsegments = ReadSegments(settings.segment_filename);
+	readsegments.parse(thermodynamics.segments, thermodynamics.segmentloops);
+	
+	const char nucleotides[] = "ACGU";
+	
+	printf("      n        fill  s        memory  MB           dE  kcal/mole\n");
+	printf("            float  fixed     float  fixed       float    fixed\n");
+	
+	srand(1);
+	for(std::vector<size_t>::iterator n = sizes.begin(); n != sizes.end(); ++n)
+	{
+		std::string random_rna = "";
+		for(size_t i = 0; i < *n; i++)
+		{
+			random_rna += nucleotides[rand() % 4];
+		}
+		sequence = Sequence(random_rna);
+		
+		double seconds[2];
+		double megabytes[2];
+		float energy_float = fill<Zuker>(settings, sequence, thermodynamics, seconds[0], megabytes[0]);
+		float energy_fixed = fill<FixedPointZuker>(settings, sequence, thermodynamics, seconds[1], megabytes[1]);
+		
+		printf("%7zu  %7.3f %6.3f  %8.1f %6.1f    %8.2f %8.2f\n", *n, seconds[0], seconds[1], megabytes[0], megabytes[1], energy_float, energy_fixed);
+	}
+	
+	ReadData thermodynamics_without_segments = ReadData();
+	
+	printf("\n      n     fill -p 0  s\n");
+	printf("          generic  specialized\n");
+	
+	srand(1);
+	for(std::vector<size_t>::iterator n = sizes.begin(); n != sizes.end(); ++n)
+	{
+		std::string random_rna = "";
+		for(size_t i = 0; i < *n; i++)
+		{
+			random_rna += nucleotides[rand() % 4];
+		}
+		sequence = Sequence(random_rna);
+		
+		double seconds[2];
+		double megabytes;
+		float energy_generic = fill<Zuker>(settings, sequence, thermodynamics_without_segments, seconds[0], megabytes);
+		float energy_specialized = fill<ZukerEngine<FloatEnergy, ZukerFeatures<false, false, ZUKER_CONSTANT_HAIRPIN_LENGTH> > >(settings, sequence, thermodynamics_without_segments, seconds[1], megabytes);
+		
+		printf("%7zu  %7.3f  %7.3f\n", *n, seconds[0], seconds[1]);
+		
+		if(energy_generic != energy_specialized)
+		{
+			fprintf(stderr, "The generic and the specialized engine differ\n");
+			return EXIT_FAILURE;
+		}
+	}
+	
+	return EXIT_SUCCESS;
+}
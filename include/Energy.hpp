@@ -0,0 +1,116 @@
+/**
+ * @file include/Energy.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ENERGY_HPP
+#define	ENERGY_HPP
+
+
+
+#include "main.hpp"
+
+
+
+/**
+ * @brief Arithmetic policy of Zuker that stores the energies as floats in kcal/mol
+ *
+ * @section DESCRIPTION
+ * Infinity is N_INFINITY, half of the largest float, so that the sum of
+ * two infinities does not overflow.
+ */
+class FloatEnergy
+{
+	public:
+		typedef float type;
+		
+		static inline float infinity(void)
+		{
+			return N_INFINITY;
+		}
+		
+		static inline float from_kcal(float arg_energy)
+		{
+			return arg_energy;
+		}
+		
+		static inline float to_kcal(float arg_energy)
+		{
+			return arg_energy;
+		}
+};
+
+
+
+/**
+ * @brief Arithmetic policy of Zuker that stores the energies as 32-bit integers in dcal/mol
+ *
+ * @section DESCRIPTION
+ * The parameters are given with a precision of 0.1 kcal/mol, so they
+ * are exactly representable. Energies that are calculated with
+ * logarithms (loops longer than the tables) are rounded to the nearest
+ * dcal/mol; the results may therefore differ slightly from FloatEnergy,
+ * but integer sums and comparisons are identical for every compiler
+ * and number of threads.
+ *
+ * Infinity is a quarter of INT32_MAX. from_kcal() saturates: every
+ * energy of at least that size, including N_INFINITY, becomes infinity.
+ * The fill only stores a sum if it is smaller than a stored value, so
+ * the matrices never hold more than infinity and the sum of three
+ * matrix values or elements can not overflow.
+ */
+class FixedPointEnergy
+{
+	public:
+		typedef int32_t type;
+		
+		static inline int32_t infinity(void)
+		{
+			return INT32_MAX / 4;
+		}
+		
+		static inline int32_t from_kcal(float arg_energy)
+		{
+			float dcal = arg_energy * 10.0f;
+			
+			if(dcal >= (float) FixedPointEnergy::infinity())
+			{
+				return FixedPointEnergy::infinity();
+			}
+			else if(dcal <= (float) -FixedPointEnergy::infinity())
+			{
+				return -FixedPointEnergy::infinity();
+			}
+			
+			return (int32_t) lroundf(dcal);
+		}
+		
+		static inline float to_kcal(int32_t arg_energy)
+		{
+			return (arg_energy >= FixedPointEnergy::infinity()) ? N_INFINITY : (float) arg_energy / 10.0f;
+		}
+};
+
+
+
+#endif	// ENERGY_HPP
@@ -29,6 +29,9 @@
 #define	GIBBSFREEENERGY_HPP
 
 
+#include "PackedSequence.hpp"
+#include "PairingMatrix.hpp"
+
 
 /**
  * @brief Gibbs free energy table (including caching functions)
@@ -47,9 +50,12 @@ class GibbsFreeEnergy
 		
 		inline float get_miscloop(unsigned char arg_param);
 		
+		std::vector<float> triloop_table;								// triloop_map indexed by the packed 5 nt key
+		std::vector<float> tloop_table;									// tloop_map indexed by the packed 6 nt key
+		
 		/// @todo merge these three functions into get_loop and use the sizes to further distinguish between tetra and triloop
-		inline float get_triloop(Sequence &arg_subsequence);			///@todo consider using &SubSequence as argument
-		inline float get_tloop(Sequence &arg_subsequence);
+		inline float get_triloop(Pair &arg_pair);
+		inline float get_tloop(Pair &arg_pair);
 		
 		inline float get_stack(Pairing &paring1, Pairing &pairing2);// Stack after stack
 		inline float get_tstacki(Pairing &paring1, Nucleotide arg_i1, Nucleotide arg_j1);// Terminal stack interior
@@ -69,6 +75,8 @@ class GibbsFreeEnergy
 		inline void interpolate_loop_interior();
 		inline void interpolate_loop_hairpin_C_penalty();
 		
+		void pack_loop_table(std::map<Sequence, float> &arg_map, size_t arg_size, std::vector<float> &arg_table);
+		
 		//@note the following functions might me implemented one day
 		//inline float get_tstackcoax();
 		//inline float get_tstackm();
@@ -81,14 +89,22 @@ class GibbsFreeEnergy
 		Sequence &sequence;
 		ReadData &thermodynamics;
 		
+		PackedSequence packed_sequence;
+		PairingMatrix pairings;
+		
 	public:
 		GibbsFreeEnergy(Sequence &arg_sequence, ReadData &arg_thermodynamics);
+		GibbsFreeEnergy(Sequence &arg_sequence, ReadData &arg_thermodynamics, size_t arg_max_span);
 		
 		float get_stacking_pair_element(Pair &p);
 		float get_hairpin_loop_element(Pair &p);
 		float get_bulge_loop_element(Region &r);
 		float get_interior_loop_element(Region &r);
 		
+		void get_stacking_pair_elements(size_t arg_i, size_t arg_length, float *arg_row);
+		void get_hairpin_loop_elements(size_t arg_i, size_t arg_length, float *arg_row);
+		void get_interior_loop_elements(Pair &arg_p1, size_t arg_ip, const size_t *arg_jp, size_t arg_n, float *arg_elements);
+		
 		float get_AU_penalty(Pairing &p);
 		float get_stacking_pair_without_surrounding(PairingPlus &p);
 		
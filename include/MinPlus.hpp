@@ -0,0 +1,92 @@
+/**
+ * @file include/MinPlus.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+
+#ifndef MINPLUS_HPP
+#define	MINPLUS_HPP
+
+
+
+#include "main.hpp"
+
+
+
+/**
+ * @brief Kernel that finds the minimum of a[k] + b[k] and its position
+ */
+typedef bool (*min_plus_kernel)(const float *a, const float *b, size_t n, float &energy, size_t &argmin);
+typedef bool (*min_plus_kernel_int32)(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin);
+
+
+
+/**
+ * @brief Min-plus reduction of the bifurcations in Zuker::w and Zuker::wm
+ *
+ * @section DESCRIPTION
+ * All kernels find the first k in [0, n) for which a[k] + b[k] is
+ * minimal. The energy and argmin are only updated if that sum is
+ * smaller than the given energy, exactly like the scalar loop:
+ *
+ * <PRE>
+ * for(k = 0; k < n; k++) if(a[k] + b[k] < energy) {energy = a[k] + b[k]; argmin = k;}
+ * </PRE>
+ *
+ * The vectorized kernels keep a minimum and its position per lane;
+ * because positions only increase within a lane and ties are resolved
+ * by the smallest position across lanes, the results are bit-exact
+ * equal to those of the scalar kernel.
+ *
+ * Every kernel is overloaded for float energies in kcal/mol and for
+ * int32_t energies in dcal/mol (FixedPointEnergy).
+ *
+ * reduce() uses the widest kernel the CPU supports, detected once at
+ * runtime.
+ */
+class MinPlus
+{
+	private:
+		static min_plus_kernel select(void);
+		static min_plus_kernel_int32 select_int32(void);
+		
+	public:
+		static bool scalar(const float *a, const float *b, size_t n, float &energy, size_t &argmin);
+		static bool sse2(const float *a, const float *b, size_t n, float &energy, size_t &argmin);
+		static bool avx2(const float *a, const float *b, size_t n, float &energy, size_t &argmin);
+		
+		static bool scalar(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin);
+		static bool sse2(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin);
+		static bool avx2(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin);
+		
+		static bool has_sse2(void);
+		static bool has_avx2(void);
+		
+		static bool reduce(const float *a, const float *b, size_t n, float &energy, size_t &argmin);
+		static bool reduce(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin);
+};
+
+#endif	// MINPLUS_HPP
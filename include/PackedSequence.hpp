@@ -0,0 +1,90 @@
+/**
+ * @file include/PackedSequence.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef PACKEDSEQUENCE_HPP
+#define	PACKEDSEQUENCE_HPP
+
+
+
+#include "main.hpp"
+
+#include "Nucleotide.hpp"
+#include "Sequence.hpp"
+
+
+
+#define PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD 32
+
+
+
+/**
+ * @brief Read-only copy of a Sequence that stores 2 bits per nucleotide
+ *
+ * @section DESCRIPTION
+ * Nucleotides are stored from the most significant bits of each 64-bit
+ * word downwards. Every window of at most SUBSEQUENCE_MAX_PACKED_SIZE
+ * nucleotides therefore spans at most two words, and its key is
+ * obtained by a pair of shifts, without allocating or looping over the
+ * nucleotides. The keys are identical to those of SubSequence::pack(),
+ * so windows can be compared to each other or looked up in tables that
+ * are keyed by packed sequences in O(1).
+ */
+class PackedSequence
+{
+	private:
+		std::vector<uint64_t> words;
+		size_t length;
+		
+	public:
+		PackedSequence(Sequence &arg_sequence);
+		
+		size_t size(void);
+		
+		Nucleotide operator[](size_t arg_position);
+		Sequence subseq(size_t arg_start, size_t arg_stop);
+		
+		/**
+		 * @brief Returns the key of the window [arg_start, arg_start + arg_size - 1]; arg_size must be between 1 and SUBSEQUENCE_MAX_PACKED_SIZE
+		 */
+		inline uint64_t key(size_t arg_start, size_t arg_size)
+		{
+			size_t word = arg_start / PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD;
+			unsigned int offset = (unsigned int)(2 * (arg_start % PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD));
+			
+			uint64_t window = this->words[word] << offset;
+			if(offset > 0)
+			{
+				window |= this->words[word + 1] >> (64 - offset);
+			}
+			
+			return window >> (64 - 2 * arg_size);
+		}
+};
+
+
+
+#endif	// PACKEDSEQUENCE_HPP
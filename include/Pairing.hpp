@@ -40,9 +40,17 @@ class Pairing
 	public:
 		PairingType type;
 		
-		Pairing(Nucleotide arg_n1, Nucleotide arg_n2);
+		static const PairingType types[4][4];							// PairingType of each combination of two Nucleotides
 		
-		void init(Nucleotide arg_n1, Nucleotide arg_n2);
+		inline Pairing(Nucleotide arg_n1, Nucleotide arg_n2)
+		{
+			this->init(arg_n1, arg_n2);
+		}
+		
+		inline void init(Nucleotide arg_n1, Nucleotide arg_n2)
+		{
+			this->type = Pairing::types[arg_n1 & 3][arg_n2 & 3];
+		}
 		
 		bool is_canonical(void);
 };
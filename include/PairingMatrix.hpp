@@ -0,0 +1,207 @@
+/**
+ * @file include/PairingMatrix.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#ifndef PAIRINGMATRIX_HPP
+#define	PAIRINGMATRIX_HPP
+
+
+
+#include "main.hpp"
+
+#include "Nucleotide.hpp"
+#include "Sequence.hpp"
+#include "PairingType.hpp"
+#include "Pairing.hpp"
+
+
+
+#define PAIRINGMATRIX_BITS_PER_WORD 64
+
+
+
+/**
+ * @brief Per-sequence table of which positions can form a canonical pair
+ *
+ * @section DESCRIPTION
+ * Row i is a bitset in which bit j is set if and only if nucleotides i
+ * and j can form a canonical pair. The relation is symmetric, so column
+ * j equals row j and both directions of a loop can be scanned within a
+ * row. Scanning uses count-leading/trailing-zero instructions, so that
+ * the positions that can not pair are skipped 64 at a time.
+ *
+ * With a maximal span only the pairs with |i - j| <= max_span are
+ * classified, and row i only holds the words that cover
+ * [i - max_span, i + max_span]. This takes O(n * max_span) bits instead
+ * of O(n * n); the other pairs are reported as not canonical.
+ *
+ * The PairingType of (i,j) is looked up in Pairing::types; an n*n plane
+ * of types would hold no more information but take 8 times the memory.
+ */
+class PairingMatrix
+{
+	private:
+		std::vector<Nucleotide> nucleotides;
+		size_t max_span;///< Largest |i - j| that is classified; n if all pairs are
+		size_t words_per_row;
+		std::vector<uint64_t> bits;
+		
+		/**
+		 * @brief Word of the sequence that is stored first in row i
+		 */
+		inline size_t first_word(size_t i)
+		{
+			return ((i > this->max_span) ? i - this->max_span : 0) / PAIRINGMATRIX_BITS_PER_WORD;
+		}
+		
+	public:
+		PairingMatrix(Sequence &arg_sequence);
+		PairingMatrix(Sequence &arg_sequence, size_t arg_max_span);
+		
+		size_t size(void);
+		
+		/**
+		 * @brief Whether nucleotides i and j can form a canonical pair
+		 */
+		inline bool is_canonical(size_t i, size_t j)
+		{
+			size_t word = j / PAIRINGMATRIX_BITS_PER_WORD - this->first_word(i);// wraps around left of the row
+			
+			return word < this->words_per_row && ((this->bits[i * this->words_per_row + word] >> (j % PAIRINGMATRIX_BITS_PER_WORD)) & 1);
+		}
+		
+		/**
+		 * @brief Returns the PairingType of nucleotides i and j
+		 */
+		inline PairingType type(size_t i, size_t j)
+		{
+			return Pairing::types[this->nucleotides[i] & 3][this->nucleotides[j] & 3];
+		}
+		
+		/**
+		 * @brief Finds the smallest position j >= arg_j and < arg_end that pairs with i, and stores it in arg_j
+		 *
+		 * @return false if there is no such position
+		 */
+		inline bool next(size_t i, size_t &arg_j, size_t arg_end)
+		{
+			if(arg_j >= arg_end)
+			{
+				return false;
+			}
+			
+			const uint64_t *row = &this->bits[i * this->words_per_row];
+			size_t row_begin = this->first_word(i);
+			size_t word = arg_j / PAIRINGMATRIX_BITS_PER_WORD;
+			size_t last_word = std::min((arg_end - 1) / PAIRINGMATRIX_BITS_PER_WORD, row_begin + this->words_per_row - 1);
+			uint64_t mask = ~((uint64_t) 0) << (arg_j % PAIRINGMATRIX_BITS_PER_WORD);
+			
+			if(word < row_begin)
+			{
+				word = row_begin;
+				mask = ~((uint64_t) 0);
+			}
+			
+			if(word > last_word)
+			{
+				return false;
+			}
+			
+			uint64_t value = row[word - row_begin] & mask;
+			while(value == 0)
+			{
+				if(++word > last_word)
+				{
+					return false;
+				}
+				value = row[word - row_begin];
+			}
+			
+			size_t j = word * PAIRINGMATRIX_BITS_PER_WORD + (size_t) __builtin_ctzll(value);
+			if(j >= arg_end)
+			{
+				return false;
+			}
+			
+			arg_j = j;
+			return true;
+		}
+		
+		/**
+		 * @brief Finds the largest position j < arg_j and >= arg_begin that pairs with i, and stores it in arg_j
+		 *
+		 * @return false if there is no such position
+		 */
+		inline bool previous(size_t i, size_t &arg_j, size_t arg_begin)
+		{
+			if(arg_j <= arg_begin)
+			{
+				return false;
+			}
+			
+			const uint64_t *row = &this->bits[i * this->words_per_row];
+			size_t row_begin = this->first_word(i);
+			size_t last = arg_j - 1;
+			size_t word = last / PAIRINGMATRIX_BITS_PER_WORD;
+			size_t first_word = std::max(arg_begin / PAIRINGMATRIX_BITS_PER_WORD, row_begin);
+			uint64_t mask = ~((uint64_t) 0) >> (PAIRINGMATRIX_BITS_PER_WORD - 1 - last % PAIRINGMATRIX_BITS_PER_WORD);
+			
+			if(word >= row_begin + this->words_per_row)
+			{
+				word = row_begin + this->words_per_row - 1;
+				mask = ~((uint64_t) 0);
+			}
+			
+			if(word < first_word)
+			{
+				return false;
+			}
+			
+			uint64_t value = row[word - row_begin] & mask;
+			while(value == 0)
+			{
+				if(word-- == first_word)
+				{
+					return false;
+				}
+				value = row[word - row_begin];
+			}
+			
+			size_t j = word * PAIRINGMATRIX_BITS_PER_WORD + PAIRINGMATRIX_BITS_PER_WORD - 1 - (size_t) __builtin_clzll(value);
+			if(j < arg_begin)
+			{
+				return false;
+			}
+			
+			arg_j = j;
+			return true;
+		}
+};
+
+
+
+#endif	// PAIRINGMATRIX_HPP
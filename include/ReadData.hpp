@@ -40,6 +40,69 @@
 #include <map>
 
 
+
+#define READDATA_FILE_MAGIC   "SFPARAMS"
+#define READDATA_FILE_VERSION 1
+
+
+
+/**
+ * @brief Layout of a binary parameter file (version 1), stored in native byte order
+ *
+ * @section DESCRIPTION
+ * The header is followed by n_tloop + n_triloop readdata_file_loop
+ * entries. Files are written by 'readdata_tables FILE' and selected
+ * with 'segmentation-fold -P FILE'.
+ */
+struct readdata_file_header
+{
+	char magic[8];
+	uint32_t version;
+	
+	uint32_t minimal_hairpin_length;
+	uint32_t n_tloop;
+	uint32_t n_triloop;
+	
+	float int11[6][6][4][4];
+	float int21[6][6][4][4][4];
+	float int22[6][6][4][4][4][4];
+	
+	float stack[6][6];
+	float tstackh[6][4][4];
+	float tstki[6][4][4];
+	
+	float miscloop[20];
+	
+	float loop_hairpin[30 + 1];
+	float loop_bulge[30 + 1];
+	float loop_interior[30 + 1];
+	
+	float poppen_p[5];
+};
+
+
+
+/**
+ * @brief A sequence specific hairpin loop in a binary parameter file
+ */
+struct readdata_file_loop
+{
+	char sequence[8];///< NUL terminated
+	float energy;
+};
+
+
+
+/**
+ * @brief A sequence specific hairpin loop of the compiled tables; a list of these is terminated by an entry with sequence nullptr
+ */
+struct readdata_loop
+{
+	const char *sequence;
+	float energy;
+};
+
+
 /**
  * @brief Reads the thermodynamic Gibbs energy parameters.
  *
@@ -74,6 +137,15 @@
  * - prelog
  *
  * - segments			List of all K-turns found in the data-file
+ *
+ * The parameters are compiled into constexpr tables (ReadDataTables.hpp)
+ * that are copied by the constructor. The load_*() functions, which are
+ * not part of the segmentation-fold binary, are the source from which
+ * these tables are generated by 'make tables'.
+ *
+ * Alternatively, a different parameter set can be read from a binary
+ * parameter file (readdata_file_header), which is memory mapped rather
+ * than parsed.
  */
 class ReadData
 {
@@ -106,6 +178,10 @@ class ReadData
 		
 		ReadData();
 		
+		void load(void);
+		void load(std::string arg_filename);
+		void save(std::string arg_filename);
+		
 		char **get_datadirs(void);
 		std::string *get_segments_file(void);
 		
@@ -0,0 +1,1709 @@
+/**
+ * @file include/ReadDataTables.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section DESCRIPTION
+ * Thermodynamic parameters as compiled tables, copied by ReadData::ReadData().
+ *
+ * This file is generated by 'make tables' from the ReadData::load_*()
+ * functions in src/ReadDataLoader.cpp - do not edit it by hand.
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef READDATATABLES_HPP
+#define	READDATATABLES_HPP
+
+
+
+constexpr float READDATA_INT11[6][6][4][4] =
+{
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.5f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.0f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.2f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	0.4f, -0.4f, 0.4f, 0.4f, 0.3f, 0.5f, 0.4f, 0.5f,
+	-0.1f, 0.4f, -1.7f, 0.4f, 0.4f, 0.0f, 0.4f, -0.3f,
+	1.1f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+	0.4f, 0.4f, -1.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	0.8f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+	0.4f, 0.4f, -2.1f, 0.4f, 0.4f, 0.4f, 0.4f, -0.7f,
+	0.4f, 0.3f, -0.1f, 0.4f, -0.4f, 0.5f, 0.4f, 0.0f,
+	0.4f, 0.4f, -1.7f, 0.4f, 0.4f, 0.5f, 0.4f, -0.3f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.0f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.8f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.5f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.1f, 1.1f, -1.0f, 1.1f, 1.1f, 1.1f, 1.1f, 1.1f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+	1.7f, 1.7f, -0.4f, 1.7f, 1.7f, 1.7f, 1.7f, 1.7f,
+};
+
+
+
+constexpr float READDATA_INT21[6][6][4][4][4] =
+{
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	2.3f, 2.1f, 0.8f, 4.0f, 2.2f, 1.7f, 0.6f, 4.0f,
+	1.1f, 1.6f, 0.4f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	2.3f, 2.2f, 4.0f, 2.5f, 2.2f, 2.5f, 4.0f, 1.9f,
+	4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 2.2f, 4.0f, 2.2f,
+	1.7f, 4.0f, 0.8f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	0.8f, 4.0f, 2.2f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 4.0f, 1.7f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 1.5f, 4.0f, 1.2f,
+	2.4f, 2.1f, 1.0f, 4.0f, 2.2f, 1.7f, 0.6f, 4.0f,
+	1.6f, 1.6f, 0.4f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	2.3f, 2.2f, 4.0f, 2.5f, 2.2f, 2.5f, 4.0f, 1.9f,
+	4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 2.2f, 4.0f, 2.2f,
+	1.7f, 4.0f, 0.8f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	0.8f, 4.0f, 2.2f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 4.0f, 1.7f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 1.3f, 4.0f, 1.2f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	2.4f, 2.1f, 1.0f, 4.0f, 2.2f, 1.7f, 0.6f, 4.0f,
+	1.6f, 1.6f, 0.4f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	2.3f, 2.2f, 4.0f, 2.5f, 2.2f, 2.5f, 4.0f, 1.9f,
+	4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 2.2f, 4.0f, 2.2f,
+	1.7f, 4.0f, 0.8f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	0.8f, 4.0f, 2.2f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 4.0f, 1.7f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 1.3f, 4.0f, 1.2f,
+	2.5f, 2.1f, 1.2f, 4.0f, 2.2f, 1.7f, 0.6f, 4.0f,
+	2.1f, 1.6f, 0.4f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	2.3f, 2.2f, 4.0f, 2.5f, 2.2f, 2.5f, 4.0f, 1.9f,
+	4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 2.2f, 4.0f, 2.2f,
+	1.7f, 4.0f, 0.8f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	0.8f, 4.0f, 2.2f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 2.2f, 4.0f, 1.7f,
+	4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 1.2f, 4.0f, 1.2f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.2f, 2.9f, 1.8f, 4.8f, 3.0f, 2.5f, 1.4f, 4.8f,
+	2.4f, 2.4f, 1.2f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	3.1f, 3.0f, 4.8f, 3.3f, 3.0f, 3.3f, 4.8f, 2.7f,
+	4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 3.0f, 4.8f, 3.0f,
+	2.5f, 4.8f, 1.6f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	1.6f, 4.8f, 3.0f, 4.8f, 4.8f, 4.8f, 4.8f, 4.8f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 3.0f, 4.8f, 2.5f,
+	4.8f, 4.8f, 4.8f, 4.8f, 4.8f, 2.1f, 4.8f, 2.0f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+	3.9f, 3.6f, 2.5f, 5.5f, 3.7f, 3.2f, 2.1f, 5.5f,
+	3.1f, 3.1f, 1.9f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	3.8f, 3.7f, 5.5f, 4.0f, 3.7f, 4.0f, 5.5f, 3.4f,
+	5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 3.7f, 5.5f, 3.7f,
+	3.2f, 5.5f, 2.3f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	2.3f, 5.5f, 3.7f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 3.7f, 5.5f, 3.2f,
+	5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 2.8f, 5.5f, 2.7f,
+};
+
+
+
+constexpr float READDATA_INT22[6][6][4][4][4][4] =
+{
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.6f, 2.2f, 1.6f, 2.0f, 2.6f, 2.6f, 2.0f, 2.6f,
+	1.6f, 2.0f, 2.0f, -0.2f, 2.0f, 2.3f, 1.1f, 1.8f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.1f, 1.5f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 1.9f, -0.3f, 2.0f, 2.2f, 1.0f, 1.7f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.6f, 1.0f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.4f, 0.3f, 2.0f, 2.4f, 1.5f, 2.2f,
+	2.3f, 0.9f, 2.1f, 2.0f, 1.3f, 2.3f, 2.0f, 2.3f,
+	2.1f, 2.0f, 1.7f, -1.5f, 2.0f, 2.0f, -0.2f, 2.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.3f, -0.1f, 1.1f, 2.0f, 0.3f, 1.3f, 2.0f, 1.3f,
+	1.1f, 2.0f, 0.7f, -2.5f, 2.0f, 1.0f, -1.2f, 1.3f,
+	2.7f, 1.2f, 2.4f, 2.0f, 1.7f, 1.7f, 2.0f, 1.7f,
+	2.4f, 2.0f, 2.0f, 0.7f, 2.0f, 1.4f, 1.9f, 0.8f,
+	2.1f, 1.9f, 0.1f, 2.0f, 1.8f, 2.5f, 2.0f, 1.5f,
+	0.7f, 2.0f, 1.8f, 0.0f, 2.0f, 2.5f, 0.4f, 2.1f,
+	2.0f, 1.7f, 0.0f, 2.0f, 1.7f, 1.7f, 2.0f, 0.7f,
+	0.6f, 2.0f, 1.6f, -1.2f, 2.0f, 1.8f, -0.8f, 1.0f,
+	0.9f, 0.6f, -1.1f, 2.0f, 0.6f, 1.6f, 2.0f, 0.7f,
+	-0.5f, 2.0f, 0.5f, -0.5f, 2.0f, 1.7f, -0.1f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.6f, -0.1f, 2.0f, 1.6f, 1.6f, 2.0f, 0.6f,
+	0.5f, 2.0f, 1.5f, -1.3f, 2.0f, 1.7f, -0.9f, 0.9f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	0.9f, 0.6f, -1.1f, 2.0f, 0.6f, 1.6f, 2.0f, 0.7f,
+	-0.5f, 2.0f, 0.5f, -0.5f, 2.0f, 1.7f, -0.1f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.4f, 1.2f, -0.6f, 2.0f, 1.1f, 1.8f, 2.0f, 0.8f,
+	0.0f, 2.0f, 1.1f, -0.7f, 2.0f, 1.8f, -0.3f, 1.4f,
+	1.7f, 0.4f, 0.5f, 2.0f, 0.4f, 1.4f, 2.0f, 0.5f,
+	1.1f, 2.0f, 1.3f, -2.5f, 2.0f, 1.5f, -2.1f, 1.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	0.7f, -0.5f, -0.5f, 2.0f, -0.6f, 0.5f, 2.0f, -0.5f,
+	0.1f, 2.0f, 0.4f, -3.5f, 2.0f, 0.5f, -3.1f, 0.5f,
+	2.0f, 0.8f, 0.8f, 2.0f, 0.7f, 0.8f, 2.0f, -0.2f,
+	1.5f, 2.0f, 1.7f, -0.3f, 2.0f, 0.8f, 0.1f, 0.0f,
+	2.0f, 1.9f, 1.0f, 2.0f, 2.4f, 2.8f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.8f, 0.3f, 2.0f, 2.7f, 1.8f, 2.2f,
+	1.9f, 1.8f, 0.9f, 2.0f, 2.2f, 2.1f, 2.0f, 1.9f,
+	0.9f, 2.0f, 1.6f, -0.8f, 2.0f, 1.9f, 0.7f, 1.0f,
+	0.8f, 0.7f, -0.2f, 2.0f, 1.1f, 2.0f, 2.0f, 1.8f,
+	-0.2f, 2.0f, 0.5f, -0.1f, 2.0f, 1.8f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.7f, 0.8f, 2.0f, 2.1f, 2.0f, 2.0f, 1.8f,
+	0.8f, 2.0f, 1.5f, -0.9f, 2.0f, 1.8f, 0.6f, 0.9f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	0.8f, 0.7f, -0.2f, 2.0f, 1.1f, 2.0f, 2.0f, 1.8f,
+	-0.2f, 2.0f, 0.5f, -0.1f, 2.0f, 1.8f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.3f, 1.2f, 0.3f, 2.0f, 1.7f, 2.1f, 2.0f, 2.0f,
+	0.3f, 2.0f, 1.1f, -0.4f, 2.0f, 2.0f, 1.1f, 1.5f,
+	1.6f, 0.5f, 1.4f, 2.0f, 0.9f, 1.8f, 2.0f, 1.6f,
+	1.4f, 2.0f, 1.3f, -2.1f, 2.0f, 1.6f, -0.6f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	0.6f, -0.5f, 0.4f, 2.0f, 0.0f, 0.8f, 2.0f, 0.7f,
+	0.4f, 2.0f, 0.4f, -3.1f, 2.0f, 0.7f, -1.6f, 0.6f,
+	1.9f, 0.8f, 1.8f, 2.0f, 1.3f, 1.1f, 2.0f, 1.0f,
+	1.8f, 2.0f, 1.7f, 0.0f, 2.0f, 1.0f, 1.6f, 0.1f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.6f, 2.4f, 1.4f, 2.0f, 2.5f, 2.3f, 2.0f, 2.3f,
+	1.4f, 2.0f, 1.9f, 0.2f, 2.0f, 2.3f, 1.2f, 1.5f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.3f, 1.3f, 2.0f, 2.4f, 2.2f, 2.0f, 2.2f,
+	1.3f, 2.0f, 1.8f, 0.1f, 2.0f, 2.2f, 1.1f, 1.4f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.8f, 0.8f, 2.0f, 1.9f, 2.4f, 2.0f, 2.4f,
+	0.8f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.6f, 2.0f,
+	2.3f, 1.1f, 1.9f, 2.0f, 1.2f, 2.0f, 2.0f, 2.0f,
+	1.9f, 2.0f, 1.6f, -1.1f, 2.0f, 2.0f, -0.1f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.3f, 0.1f, 0.9f, 2.0f, 0.2f, 1.0f, 2.0f, 1.0f,
+	0.9f, 2.0f, 0.7f, -2.1f, 2.0f, 1.0f, -1.1f, 1.1f,
+	2.7f, 1.4f, 2.2f, 2.0f, 1.5f, 1.4f, 2.0f, 1.4f,
+	2.2f, 2.0f, 2.0f, 1.1f, 2.0f, 1.4f, 2.0f, 0.6f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.6f, 2.2f, 1.6f, 2.0f, 2.6f, 2.6f, 2.0f, 2.6f,
+	1.6f, 2.0f, 2.0f, -0.2f, 2.0f, 2.3f, 1.1f, 1.8f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.1f, 1.5f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 1.9f, -0.3f, 2.0f, 2.2f, 1.0f, 1.7f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.6f, 1.0f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.4f, 0.3f, 2.0f, 2.4f, 1.5f, 2.2f,
+	2.3f, 0.9f, 2.1f, 2.0f, 1.3f, 2.3f, 2.0f, 2.3f,
+	2.1f, 2.0f, 1.7f, -1.5f, 2.0f, 2.0f, -0.2f, 2.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.3f, -0.1f, 1.1f, 2.0f, 0.3f, 1.3f, 2.0f, 1.3f,
+	1.1f, 2.0f, 0.7f, -2.5f, 2.0f, 1.0f, -1.2f, 1.3f,
+	2.7f, 1.2f, 2.4f, 2.0f, 1.7f, 1.7f, 2.0f, 1.7f,
+	2.4f, 2.0f, 2.0f, 0.7f, 2.0f, 1.4f, 1.9f, 0.8f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.6f, 2.4f, 1.4f, 2.0f, 2.5f, 2.3f, 2.0f, 2.3f,
+	1.4f, 2.0f, 1.9f, 0.2f, 2.0f, 2.3f, 1.2f, 1.5f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.3f, 1.3f, 2.0f, 2.4f, 2.2f, 2.0f, 2.2f,
+	1.3f, 2.0f, 1.8f, 0.1f, 2.0f, 2.2f, 1.1f, 1.4f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.8f, 0.8f, 2.0f, 1.9f, 2.4f, 2.0f, 2.4f,
+	0.8f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.6f, 2.0f,
+	2.3f, 1.1f, 1.9f, 2.0f, 1.2f, 2.0f, 2.0f, 2.0f,
+	1.9f, 2.0f, 1.6f, -1.1f, 2.0f, 2.0f, -0.1f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.3f, 0.1f, 0.9f, 2.0f, 0.2f, 1.0f, 2.0f, 1.0f,
+	0.9f, 2.0f, 0.7f, -2.1f, 2.0f, 1.0f, -1.1f, 1.1f,
+	2.7f, 1.4f, 2.2f, 2.0f, 1.5f, 1.4f, 2.0f, 1.4f,
+	2.2f, 2.0f, 2.0f, 1.1f, 2.0f, 1.4f, 2.0f, 0.6f,
+	2.0f, 1.6f, 1.0f, 2.0f, 2.0f, 2.6f, 2.0f, 2.6f,
+	1.0f, 2.0f, 1.4f, 0.2f, 2.0f, 2.3f, 1.5f, 2.2f,
+	2.4f, 1.9f, 1.3f, 2.0f, 2.4f, 2.4f, 2.0f, 2.4f,
+	1.3f, 2.0f, 1.7f, -0.4f, 2.0f, 2.1f, 0.8f, 1.5f,
+	1.0f, 0.6f, 0.0f, 2.0f, 1.0f, 2.0f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.4f, 0.0f, 2.0f, 1.7f, 1.3f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.5f, 0.9f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	0.9f, 2.0f, 1.3f, -0.9f, 2.0f, 1.6f, 0.4f, 1.1f,
+	2.8f, 1.8f, 2.2f, 2.0f, 2.2f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.2f, 0.4f, 2.0f, 1.9f, 1.7f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.6f, 2.0f, 2.0f, 2.1f, 2.1f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.0f, 0.3f, 2.0f, 1.8f, 1.5f, 1.2f,
+	1.0f, 0.6f, 0.0f, 2.0f, 1.0f, 2.0f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.4f, 0.0f, 2.0f, 1.7f, 1.3f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.3f, 0.7f, 2.0f, 1.8f, 2.4f, 2.0f, 2.4f,
+	0.7f, 2.0f, 1.1f, 0.0f, 2.0f, 2.1f, 1.2f, 1.9f,
+	1.8f, 0.4f, 1.6f, 2.0f, 0.8f, 1.8f, 2.0f, 1.8f,
+	1.6f, 2.0f, 1.2f, -2.0f, 2.0f, 1.5f, -0.7f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.6f, 2.0f, 2.0f, 2.1f, 2.1f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.0f, 0.3f, 2.0f, 1.8f, 1.5f, 1.2f,
+	0.3f, -1.1f, 0.1f, 2.0f, -0.7f, 0.3f, 2.0f, 0.3f,
+	0.1f, 2.0f, -0.3f, -3.5f, 2.0f, 0.0f, -2.2f, 0.3f,
+	2.2f, 0.7f, 1.9f, 2.0f, 1.2f, 1.2f, 2.0f, 1.2f,
+	1.9f, 2.0f, 1.5f, 0.2f, 2.0f, 0.9f, 1.5f, 0.3f,
+	0.5f, 1.1f, -0.3f, 2.0f, 1.1f, 1.7f, 2.0f, 0.7f,
+	0.4f, 2.0f, 1.0f, 0.1f, 2.0f, 1.8f, -0.5f, 1.5f,
+	0.6f, 1.5f, 0.1f, 2.0f, 1.1f, 1.5f, 2.0f, 0.5f,
+	0.5f, 2.0f, 1.4f, -0.7f, 2.0f, 1.5f, -0.6f, 0.0f,
+	0.0f, -0.7f, -1.6f, 2.0f, -1.0f, -0.6f, 2.0f, 0.2f,
+	-0.7f, 2.0f, 0.0f, -0.8f, 2.0f, 1.2f, -0.6f, 0.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.3f, 1.0f, -0.7f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f,
+	0.7f, 2.0f, 0.9f, -1.9f, 2.0f, 1.1f, -1.5f, -0.2f,
+	2.2f, 1.3f, 0.7f, 2.0f, 1.9f, 1.3f, 2.0f, 0.3f,
+	0.7f, 2.0f, 1.8f, -0.3f, 2.0f, 1.4f, -0.2f, -0.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 1.2f, 0.4f, 2.0f, 1.1f, 1.2f, 2.0f, 1.7f,
+	1.0f, 2.0f, 1.7f, -0.7f, 2.0f, 1.2f, -0.3f, 0.2f,
+	-0.2f, -0.4f, -1.7f, 2.0f, 0.7f, 1.1f, 2.0f, 0.2f,
+	-0.5f, 2.0f, 0.0f, -0.9f, 2.0f, 1.2f, -1.3f, 0.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.1f, 0.9f, -0.9f, 2.0f, 0.8f, 1.5f, 2.0f, 0.5f,
+	-0.2f, 2.0f, 0.8f, -1.0f, 2.0f, 1.5f, -0.6f, 1.1f,
+	0.9f, 0.0f, 0.3f, 2.0f, -0.1f, 1.0f, 2.0f, 0.0f,
+	0.6f, 2.0f, 0.9f, -3.0f, 2.0f, 1.0f, -2.4f, 0.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 1.2f, 0.4f, 2.0f, 1.1f, 1.2f, 2.0f, 0.2f,
+	0.5f, 2.0f, 1.7f, -0.7f, 2.0f, 1.2f, -0.1f, 0.4f,
+	-0.1f, -1.6f, -1.6f, 2.0f, -1.6f, -0.6f, 2.0f, -1.6f,
+	-0.6f, 2.0f, -0.7f, -4.4f, 2.0f, -0.5f, -4.1f, -1.0f,
+	1.4f, 0.3f, 0.5f, 2.0f, 0.3f, 0.3f, 2.0f, 0.1f,
+	1.4f, 2.0f, 1.2f, -1.0f, 2.0f, 0.3f, 0.1f, 0.6f,
+	1.3f, 1.2f, 0.3f, 2.0f, 1.6f, 2.1f, 2.0f, 1.9f,
+	0.3f, 2.0f, 1.0f, -0.4f, 2.0f, 1.9f, 1.1f, 1.4f,
+	1.6f, 1.5f, 0.6f, 2.0f, 2.0f, 1.8f, 2.0f, 1.7f,
+	0.6f, 2.0f, 1.4f, -1.1f, 2.0f, 1.7f, 0.4f, 0.8f,
+	0.3f, 0.2f, -0.7f, 2.0f, 0.6f, 1.5f, 2.0f, 1.3f,
+	-0.7f, 2.0f, 0.0f, -0.6f, 2.0f, 1.3f, 0.9f, 1.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.2f, 1.1f, 0.2f, 2.0f, 1.5f, 1.4f, 2.0f, 1.2f,
+	0.2f, 2.0f, 0.9f, -1.5f, 2.0f, 1.2f, 0.0f, 0.3f,
+	2.1f, 1.4f, 1.5f, 2.0f, 1.8f, 1.7f, 2.0f, 1.5f,
+	1.5f, 2.0f, 1.8f, -0.2f, 2.0f, 1.5f, 1.3f, 0.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.2f, 1.3f, 2.0f, 1.7f, 1.5f, 2.0f, 1.4f,
+	1.3f, 2.0f, 1.7f, -0.4f, 2.0f, 1.4f, 1.1f, 0.5f,
+	0.3f, 0.2f, -0.7f, 2.0f, 0.6f, 1.5f, 2.0f, 1.3f,
+	-0.7f, 2.0f, 0.0f, -0.6f, 2.0f, 1.3f, 0.9f, 1.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.0f, 0.9f, 0.0f, 2.0f, 1.4f, 1.8f, 2.0f, 1.7f,
+	0.0f, 2.0f, 0.8f, -0.7f, 2.0f, 1.7f, 0.9f, 1.2f,
+	1.1f, 0.0f, 0.9f, 2.0f, 0.4f, 1.3f, 2.0f, 1.1f,
+	0.9f, 2.0f, 0.9f, -2.6f, 2.0f, 1.1f, -1.1f, 1.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.2f, 1.3f, 2.0f, 1.7f, 1.5f, 2.0f, 1.4f,
+	1.3f, 2.0f, 1.7f, -0.4f, 2.0f, 1.4f, 1.1f, 0.5f,
+	-0.4f, -1.5f, -0.6f, 2.0f, -1.1f, -0.2f, 2.0f, -0.4f,
+	-0.6f, 2.0f, -0.7f, -4.2f, 2.0f, -0.4f, -2.6f, -0.5f,
+	1.4f, 0.3f, 1.3f, 2.0f, 0.8f, 0.6f, 2.0f, 0.5f,
+	1.3f, 2.0f, 1.2f, -0.5f, 2.0f, 0.5f, 1.1f, -0.4f,
+	2.0f, 1.8f, 0.8f, 2.0f, 1.9f, 2.3f, 2.0f, 2.3f,
+	0.8f, 2.0f, 1.3f, 0.6f, 2.0f, 2.3f, 1.6f, 1.9f,
+	2.4f, 2.1f, 1.1f, 2.0f, 2.2f, 2.1f, 2.0f, 2.1f,
+	1.1f, 2.0f, 1.7f, 0.0f, 2.0f, 2.1f, 0.9f, 1.3f,
+	1.0f, 0.8f, -0.2f, 2.0f, 0.9f, 1.7f, 2.0f, 1.7f,
+	-0.2f, 2.0f, 0.3f, 0.4f, 2.0f, 1.7f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.7f, 0.7f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	0.7f, 2.0f, 1.2f, -0.5f, 2.0f, 1.6f, 0.5f, 0.8f,
+	2.8f, 2.0f, 2.0f, 2.0f, 2.1f, 1.9f, 2.0f, 1.9f,
+	2.0f, 2.0f, 2.1f, 0.8f, 2.0f, 1.9f, 1.8f, 1.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.8f, 1.8f, 2.0f, 1.9f, 1.8f, 2.0f, 1.8f,
+	1.8f, 2.0f, 2.0f, 0.7f, 2.0f, 1.8f, 1.6f, 1.0f,
+	1.0f, 0.8f, -0.2f, 2.0f, 0.9f, 1.7f, 2.0f, 1.7f,
+	-0.2f, 2.0f, 0.3f, 0.4f, 2.0f, 1.7f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.5f, 0.5f, 2.0f, 1.6f, 2.1f, 2.0f, 2.1f,
+	0.5f, 2.0f, 1.1f, 0.4f, 2.0f, 2.1f, 1.3f, 1.7f,
+	1.8f, 0.6f, 1.4f, 2.0f, 0.7f, 1.5f, 2.0f, 1.5f,
+	1.4f, 2.0f, 1.1f, -1.6f, 2.0f, 1.5f, -0.6f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.8f, 1.8f, 2.0f, 1.9f, 1.8f, 2.0f, 1.8f,
+	1.8f, 2.0f, 2.0f, 0.7f, 2.0f, 1.8f, 1.6f, 1.0f,
+	0.3f, -0.9f, -0.1f, 2.0f, -0.8f, 0.0f, 2.0f, 0.0f,
+	-0.1f, 2.0f, -0.4f, -3.1f, 2.0f, 0.0f, -2.1f, 0.0f,
+	2.2f, 0.9f, 1.8f, 2.0f, 1.0f, 0.9f, 2.0f, 0.9f,
+	1.8f, 2.0f, 1.5f, 0.6f, 2.0f, 0.9f, 1.6f, 0.1f,
+	2.0f, 1.6f, 1.0f, 2.0f, 2.0f, 2.6f, 2.0f, 2.6f,
+	1.0f, 2.0f, 1.4f, 0.2f, 2.0f, 2.3f, 1.5f, 2.2f,
+	2.4f, 1.9f, 1.3f, 2.0f, 2.4f, 2.4f, 2.0f, 2.4f,
+	1.3f, 2.0f, 1.7f, -0.4f, 2.0f, 2.1f, 0.8f, 1.5f,
+	1.0f, 0.6f, 0.0f, 2.0f, 1.0f, 2.0f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.4f, 0.0f, 2.0f, 1.7f, 1.3f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.5f, 0.9f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	0.9f, 2.0f, 1.3f, -0.9f, 2.0f, 1.6f, 0.4f, 1.1f,
+	2.8f, 1.8f, 2.2f, 2.0f, 2.2f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.2f, 0.4f, 2.0f, 1.9f, 1.7f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.6f, 2.0f, 2.0f, 2.1f, 2.1f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.0f, 0.3f, 2.0f, 1.8f, 1.5f, 1.2f,
+	1.0f, 0.6f, 0.0f, 2.0f, 1.0f, 2.0f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.4f, 0.0f, 2.0f, 1.7f, 1.3f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.3f, 0.7f, 2.0f, 1.8f, 2.4f, 2.0f, 2.4f,
+	0.7f, 2.0f, 1.1f, 0.0f, 2.0f, 2.1f, 1.2f, 1.9f,
+	1.8f, 0.4f, 1.6f, 2.0f, 0.8f, 1.8f, 2.0f, 1.8f,
+	1.6f, 2.0f, 1.2f, -2.0f, 2.0f, 1.5f, -0.7f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.6f, 2.0f, 2.0f, 2.1f, 2.1f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.0f, 0.3f, 2.0f, 1.8f, 1.5f, 1.2f,
+	0.3f, -1.1f, 0.1f, 2.0f, -0.7f, 0.3f, 2.0f, 0.3f,
+	0.1f, 2.0f, -0.3f, -3.5f, 2.0f, 0.0f, -2.2f, 0.3f,
+	2.2f, 0.7f, 1.9f, 2.0f, 1.2f, 1.2f, 2.0f, 1.2f,
+	1.9f, 2.0f, 1.5f, 0.2f, 2.0f, 0.9f, 1.5f, 0.3f,
+	2.0f, 1.8f, 0.8f, 2.0f, 1.9f, 2.3f, 2.0f, 2.3f,
+	0.8f, 2.0f, 1.3f, 0.6f, 2.0f, 2.3f, 1.6f, 1.9f,
+	2.4f, 2.1f, 1.1f, 2.0f, 2.2f, 2.1f, 2.0f, 2.1f,
+	1.1f, 2.0f, 1.7f, 0.0f, 2.0f, 2.1f, 0.9f, 1.3f,
+	1.0f, 0.8f, -0.2f, 2.0f, 0.9f, 1.7f, 2.0f, 1.7f,
+	-0.2f, 2.0f, 0.3f, 0.4f, 2.0f, 1.7f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.7f, 0.7f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	0.7f, 2.0f, 1.2f, -0.5f, 2.0f, 1.6f, 0.5f, 0.8f,
+	2.8f, 2.0f, 2.0f, 2.0f, 2.1f, 1.9f, 2.0f, 1.9f,
+	2.0f, 2.0f, 2.1f, 0.8f, 2.0f, 1.9f, 1.8f, 1.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.8f, 1.8f, 2.0f, 1.9f, 1.8f, 2.0f, 1.8f,
+	1.8f, 2.0f, 2.0f, 0.7f, 2.0f, 1.8f, 1.6f, 1.0f,
+	1.0f, 0.8f, -0.2f, 2.0f, 0.9f, 1.7f, 2.0f, 1.7f,
+	-0.2f, 2.0f, 0.3f, 0.4f, 2.0f, 1.7f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.5f, 0.5f, 2.0f, 1.6f, 2.1f, 2.0f, 2.1f,
+	0.5f, 2.0f, 1.1f, 0.4f, 2.0f, 2.1f, 1.3f, 1.7f,
+	1.8f, 0.6f, 1.4f, 2.0f, 0.7f, 1.5f, 2.0f, 1.5f,
+	1.4f, 2.0f, 1.1f, -1.6f, 2.0f, 1.5f, -0.6f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.8f, 1.8f, 2.0f, 1.9f, 1.8f, 2.0f, 1.8f,
+	1.8f, 2.0f, 2.0f, 0.7f, 2.0f, 1.8f, 1.6f, 1.0f,
+	0.3f, -0.9f, -0.1f, 2.0f, -0.8f, 0.0f, 2.0f, 0.0f,
+	-0.1f, 2.0f, -0.4f, -3.1f, 2.0f, 0.0f, -2.1f, 0.0f,
+	2.2f, 0.9f, 1.8f, 2.0f, 1.0f, 0.9f, 2.0f, 0.9f,
+	1.8f, 2.0f, 1.5f, 0.6f, 2.0f, 0.9f, 1.6f, 0.1f,
+	2.1f, 1.7f, 1.1f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.1f, 2.0f, 1.5f, 0.3f, 2.0f, 2.4f, 1.6f, 2.3f,
+	1.8f, 1.4f, 0.8f, 2.0f, 1.8f, 1.8f, 2.0f, 1.8f,
+	0.8f, 2.0f, 1.2f, -1.0f, 2.0f, 1.5f, 0.3f, 1.0f,
+	0.7f, 0.3f, -0.3f, 2.0f, 0.7f, 1.7f, 2.0f, 1.7f,
+	-0.3f, 2.0f, 0.1f, -0.3f, 2.0f, 1.4f, 1.0f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.4f, 0.8f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	0.8f, 2.0f, 1.2f, -0.9f, 2.0f, 1.6f, 0.3f, 1.0f,
+	2.5f, 1.4f, 1.8f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	1.8f, 2.0f, 1.8f, 0.1f, 2.0f, 1.6f, 1.3f, 1.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 1.5f, 1.9f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	1.9f, 2.0f, 1.9f, 0.1f, 2.0f, 1.6f, 1.4f, 1.1f,
+	0.1f, -0.3f, -0.9f, 2.0f, 0.1f, 1.1f, 2.0f, 1.1f,
+	-0.9f, 2.0f, -0.5f, -0.9f, 2.0f, 0.8f, 0.4f, 1.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.3f, 0.7f, 2.0f, 1.8f, 2.4f, 2.0f, 2.4f,
+	0.7f, 2.0f, 1.1f, 0.0f, 2.0f, 2.1f, 1.2f, 1.9f,
+	0.4f, -1.1f, 0.1f, 2.0f, -0.6f, 0.4f, 2.0f, 0.4f,
+	0.1f, 2.0f, -0.3f, -3.5f, 2.0f, 0.1f, -2.2f, 0.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.5f, 0.4f, 0.9f, 2.0f, 0.9f, 0.9f, 2.0f, 0.9f,
+	0.9f, 2.0f, 0.8f, -0.9f, 2.0f, 0.6f, 0.4f, 0.0f,
+	0.0f, -1.5f, -0.3f, 2.0f, -1.0f, 0.0f, 2.0f, 0.0f,
+	-0.3f, 2.0f, -0.7f, -3.9f, 2.0f, -0.3f, -2.6f, -0.1f,
+	2.1f, 0.7f, 1.9f, 2.0f, 1.1f, 1.1f, 2.0f, 1.1f,
+	1.9f, 2.0f, 1.5f, 0.1f, 2.0f, 0.8f, 1.4f, 0.3f,
+	1.5f, 1.2f, -0.5f, 2.0f, 1.2f, 1.8f, 2.0f, 0.8f,
+	0.1f, 2.0f, 1.1f, -0.7f, 2.0f, 1.9f, -0.3f, 1.5f,
+	1.2f, 0.9f, -0.8f, 2.0f, 0.9f, 0.9f, 2.0f, 0.0f,
+	-0.2f, 2.0f, 0.8f, -2.0f, 2.0f, 1.0f, -1.6f, 0.2f,
+	0.1f, -0.1f, -1.9f, 2.0f, -0.2f, 0.9f, 2.0f, -0.1f,
+	-1.3f, 2.0f, -0.2f, -1.3f, 2.0f, 0.9f, -0.9f, 0.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.2f, 1.0f, -0.8f, 2.0f, 0.9f, 1.0f, 2.0f, 0.0f,
+	-0.1f, 2.0f, 0.9f, -1.9f, 2.0f, 1.0f, -1.5f, 0.2f,
+	1.8f, 1.0f, 0.2f, 2.0f, 0.9f, 1.0f, 2.0f, 0.0f,
+	0.9f, 2.0f, 1.5f, -0.9f, 2.0f, 1.0f, -0.5f, 0.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.0f, 0.3f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f,
+	0.9f, 2.0f, 1.5f, -0.9f, 2.0f, 1.1f, -0.5f, 0.3f,
+	-0.5f, -0.8f, -2.6f, 2.0f, -0.8f, 0.2f, 2.0f, -0.8f,
+	-1.9f, 2.0f, -0.9f, -1.9f, 2.0f, 0.3f, -1.5f, 0.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.1f, 0.9f, -0.9f, 2.0f, 0.8f, 1.5f, 2.0f, 0.5f,
+	-0.2f, 2.0f, 0.8f, -1.0f, 2.0f, 1.5f, -0.6f, 1.1f,
+	-0.3f, -1.5f, -1.5f, 2.0f, -1.6f, -0.5f, 2.0f, -1.5f,
+	-0.9f, 2.0f, -0.6f, -4.5f, 2.0f, -0.5f, -4.1f, -0.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	0.8f, 0.0f, -0.8f, 2.0f, 0.0f, 0.0f, 2.0f, -1.0f,
+	-0.1f, 2.0f, 0.5f, -1.9f, 2.0f, 0.0f, -1.5f, -0.7f,
+	-0.7f, -1.9f, -1.9f, 2.0f, -2.0f, -0.9f, 2.0f, -1.9f,
+	-1.3f, 2.0f, -1.0f, -4.9f, 2.0f, -0.9f, -4.5f, -0.9f,
+	1.5f, 0.2f, 0.3f, 2.0f, 0.2f, 0.2f, 2.0f, -0.7f,
+	0.9f, 2.0f, 1.1f, -0.9f, 2.0f, 0.3f, -0.5f, -0.5f,
+	0.5f, 1.3f, -0.2f, 2.0f, 0.6f, 2.2f, 2.0f, 2.0f,
+	0.0f, 2.0f, 1.1f, -0.1f, 2.0f, 2.0f, 0.9f, 1.4f,
+	1.1f, 1.0f, 0.7f, 2.0f, 1.1f, 1.9f, 2.0f, 1.1f,
+	-1.0f, 2.0f, 0.8f, -1.6f, 2.0f, 1.1f, -0.1f, 0.3f,
+	0.4f, 0.7f, -0.5f, 2.0f, 0.5f, 0.7f, 2.0f, 0.5f,
+	-0.7f, 2.0f, -0.2f, -0.6f, 2.0f, 1.0f, 0.6f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.1f, 1.0f, -0.4f, 2.0f, 1.5f, 1.3f, 2.0f, 1.2f,
+	-0.7f, 2.0f, 0.9f, -1.6f, 2.0f, 1.2f, 0.0f, 0.3f,
+	1.7f, 1.0f, 1.1f, 2.0f, 1.5f, 1.3f, 2.0f, 1.2f,
+	-0.6f, 2.0f, 1.5f, -0.6f, 2.0f, 1.2f, 1.0f, 0.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.1f, 1.2f, 2.0f, 1.5f, 1.4f, 2.0f, 1.2f,
+	1.2f, 2.0f, 1.5f, -0.5f, 2.0f, 1.2f, 1.0f, 0.3f,
+	-0.3f, -0.7f, -1.7f, 2.0f, 0.1f, 0.7f, 2.0f, 0.4f,
+	-1.6f, 2.0f, -0.9f, -1.6f, 2.0f, 0.4f, 0.3f, 0.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.0f, 0.9f, 0.0f, 2.0f, 1.4f, 1.8f, 2.0f, 1.7f,
+	0.0f, 2.0f, 0.8f, -0.7f, 2.0f, 1.7f, 0.9f, 1.2f,
+	-0.5f, -1.5f, -1.3f, 2.0f, -0.6f, -0.2f, 2.0f, -0.1f,
+	-0.6f, 2.0f, -0.6f, -4.1f, 2.0f, -0.3f, -2.4f, 0.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	0.7f, 0.0f, 0.2f, 2.0f, 0.5f, 0.3f, 2.0f, 0.2f,
+	0.2f, 2.0f, 0.5f, -1.6f, 2.0f, 1.7f, 0.0f, 0.1f,
+	0.1f, -1.9f, -0.9f, 2.0f, -0.7f, -0.3f, 2.0f, -0.7f,
+	-0.8f, 2.0f, -1.0f, -4.4f, 2.0f, -0.7f, -3.0f, -1.0f,
+	1.5f, -0.2f, 0.9f, 2.0f, 0.0f, -0.1f, 2.0f, 0.4f,
+	0.9f, 2.0f, 1.1f, -1.0f, 2.0f, 0.2f, 0.6f, 0.6f,
+	2.1f, 1.9f, 0.9f, 2.0f, 2.0f, 2.4f, 2.0f, 2.4f,
+	0.9f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.7f, 2.0f,
+	1.8f, 1.6f, 0.6f, 2.0f, 1.7f, 1.5f, 2.0f, 1.5f,
+	0.6f, 2.0f, 1.1f, -0.6f, 2.0f, 1.5f, 0.4f, 0.7f,
+	0.7f, 0.5f, -0.5f, 2.0f, 0.6f, 1.4f, 2.0f, 1.4f,
+	-0.5f, 2.0f, 0.0f, 0.1f, 2.0f, 1.4f, 1.1f, 1.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.6f, 0.6f, 2.0f, 1.7f, 1.6f, 2.0f, 1.6f,
+	0.6f, 2.0f, 1.2f, -0.5f, 2.0f, 1.6f, 0.4f, 0.8f,
+	2.5f, 1.6f, 1.6f, 2.0f, 1.7f, 1.6f, 2.0f, 1.6f,
+	1.6f, 2.0f, 1.8f, 0.5f, 2.0f, 1.6f, 1.4f, 0.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 1.7f, 1.7f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	1.7f, 2.0f, 1.8f, 0.5f, 2.0f, 1.6f, 1.5f, 0.8f,
+	0.1f, -0.1f, -1.1f, 2.0f, 0.0f, 0.8f, 2.0f, 0.8f,
+	-1.1f, 2.0f, -0.6f, -0.5f, 2.0f, 0.8f, 0.5f, 0.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.5f, 0.5f, 2.0f, 1.6f, 2.1f, 2.0f, 2.1f,
+	0.5f, 2.0f, 1.1f, 0.4f, 2.0f, 2.1f, 1.3f, 1.7f,
+	0.4f, -0.9f, -0.1f, 2.0f, -0.8f, 0.1f, 2.0f, 0.1f,
+	-0.1f, 2.0f, -0.3f, -3.1f, 2.0f, 0.1f, -2.1f, 0.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.5f, 0.6f, 0.7f, 2.0f, 0.7f, 0.6f, 2.0f, 0.6f,
+	0.7f, 2.0f, 0.8f, -0.5f, 2.0f, 0.6f, 0.5f, -0.2f,
+	0.0f, -1.3f, -0.5f, 2.0f, -1.2f, -0.3f, 2.0f, -0.3f,
+	-0.5f, 2.0f, -0.7f, -3.5f, 2.0f, -0.3f, -2.5f, -0.3f,
+	2.1f, 0.9f, 1.7f, 2.0f, 1.0f, 0.8f, 2.0f, 0.8f,
+	1.7f, 2.0f, 1.4f, 0.5f, 2.0f, 0.8f, 1.5f, 0.0f,
+	2.1f, 1.7f, 1.1f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.1f, 2.0f, 1.5f, 0.3f, 2.0f, 2.4f, 1.6f, 2.3f,
+	1.8f, 1.4f, 0.8f, 2.0f, 1.8f, 1.8f, 2.0f, 1.8f,
+	0.8f, 2.0f, 1.2f, -1.0f, 2.0f, 1.5f, 0.3f, 1.0f,
+	0.7f, 0.3f, -0.3f, 2.0f, 0.7f, 1.7f, 2.0f, 1.7f,
+	-0.3f, 2.0f, 0.1f, -0.3f, 2.0f, 1.4f, 1.0f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.4f, 0.8f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	0.8f, 2.0f, 1.2f, -0.9f, 2.0f, 1.6f, 0.3f, 1.0f,
+	2.5f, 1.4f, 1.8f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	1.8f, 2.0f, 1.8f, 0.1f, 2.0f, 1.6f, 1.3f, 1.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 1.5f, 1.9f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	1.9f, 2.0f, 1.9f, 0.1f, 2.0f, 1.6f, 1.4f, 1.1f,
+	0.1f, -0.3f, -0.9f, 2.0f, 0.1f, 1.1f, 2.0f, 1.1f,
+	-0.9f, 2.0f, -0.5f, -0.9f, 2.0f, 0.8f, 0.4f, 1.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.3f, 0.7f, 2.0f, 1.8f, 2.4f, 2.0f, 2.4f,
+	0.7f, 2.0f, 1.1f, 0.0f, 2.0f, 2.1f, 1.2f, 1.9f,
+	0.4f, -1.1f, 0.1f, 2.0f, -0.6f, 0.4f, 2.0f, 0.4f,
+	0.1f, 2.0f, -0.3f, -3.5f, 2.0f, 0.1f, -2.2f, 0.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.5f, 0.4f, 0.9f, 2.0f, 0.9f, 0.9f, 2.0f, 0.9f,
+	0.9f, 2.0f, 0.8f, -0.9f, 2.0f, 0.6f, 0.4f, 0.0f,
+	0.0f, -1.5f, -0.3f, 2.0f, -1.0f, 0.0f, 2.0f, 0.0f,
+	-0.3f, 2.0f, -0.7f, -3.9f, 2.0f, -0.3f, -2.6f, -0.1f,
+	2.1f, 0.7f, 1.9f, 2.0f, 1.1f, 1.1f, 2.0f, 1.1f,
+	1.9f, 2.0f, 1.5f, 0.1f, 2.0f, 0.8f, 1.4f, 0.3f,
+	2.1f, 1.9f, 0.9f, 2.0f, 2.0f, 2.4f, 2.0f, 2.4f,
+	0.9f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.7f, 2.0f,
+	1.8f, 1.6f, 0.6f, 2.0f, 1.7f, 1.5f, 2.0f, 1.5f,
+	0.6f, 2.0f, 1.1f, -0.6f, 2.0f, 1.5f, 0.4f, 0.7f,
+	0.7f, 0.5f, -0.5f, 2.0f, 0.6f, 1.4f, 2.0f, 1.4f,
+	-0.5f, 2.0f, 0.0f, 0.1f, 2.0f, 1.4f, 1.1f, 1.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.6f, 0.6f, 2.0f, 1.7f, 1.6f, 2.0f, 1.6f,
+	0.6f, 2.0f, 1.2f, -0.5f, 2.0f, 1.6f, 0.4f, 0.8f,
+	2.5f, 1.6f, 1.6f, 2.0f, 1.7f, 1.6f, 2.0f, 1.6f,
+	1.6f, 2.0f, 1.8f, 0.5f, 2.0f, 1.6f, 1.4f, 0.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 1.7f, 1.7f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	1.7f, 2.0f, 1.8f, 0.5f, 2.0f, 1.6f, 1.5f, 0.8f,
+	0.1f, -0.1f, -1.1f, 2.0f, 0.0f, 0.8f, 2.0f, 0.8f,
+	-1.1f, 2.0f, -0.6f, -0.5f, 2.0f, 0.8f, 0.5f, 0.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.5f, 0.5f, 2.0f, 1.6f, 2.1f, 2.0f, 2.1f,
+	0.5f, 2.0f, 1.1f, 0.4f, 2.0f, 2.1f, 1.3f, 1.7f,
+	0.4f, -0.9f, -0.1f, 2.0f, -0.8f, 0.1f, 2.0f, 0.1f,
+	-0.1f, 2.0f, -0.3f, -3.1f, 2.0f, 0.1f, -2.1f, 0.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.5f, 0.6f, 0.7f, 2.0f, 0.7f, 0.6f, 2.0f, 0.6f,
+	0.7f, 2.0f, 0.8f, -0.5f, 2.0f, 0.6f, 0.5f, -0.2f,
+	0.0f, -1.3f, -0.5f, 2.0f, -1.2f, -0.3f, 2.0f, -0.3f,
+	-0.5f, 2.0f, -0.7f, -3.5f, 2.0f, -0.3f, -2.5f, -0.3f,
+	2.1f, 0.9f, 1.7f, 2.0f, 1.0f, 0.8f, 2.0f, 0.8f,
+	1.7f, 2.0f, 1.4f, 0.5f, 2.0f, 0.8f, 1.5f, 0.0f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 2.5f, 1.2f, 1.9f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.9f, 1.3f, 2.0f, 2.3f, 2.3f, 2.0f, 2.3f,
+	1.3f, 2.0f, 1.7f, -0.5f, 2.0f, 2.0f, 0.8f, 1.5f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.7f, 1.1f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.1f, 2.0f, 1.5f, 0.3f, 2.0f, 2.4f, 1.6f, 2.3f,
+	2.2f, 0.8f, 2.0f, 2.0f, 1.2f, 2.2f, 2.0f, 2.2f,
+	2.0f, 2.0f, 1.6f, -1.6f, 2.0f, 1.9f, -0.3f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	1.0f, -0.5f, 0.7f, 2.0f, 0.0f, 1.0f, 2.0f, 1.0f,
+	0.7f, 2.0f, 0.3f, -2.9f, 2.0f, 0.7f, -1.6f, 0.9f,
+	2.9f, 1.5f, 2.7f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	2.7f, 2.0f, 2.3f, 0.9f, 2.0f, 1.6f, 2.2f, 1.1f,
+	2.1f, 1.9f, 0.1f, 2.0f, 1.8f, 2.5f, 2.0f, 1.5f,
+	0.7f, 2.0f, 1.8f, 0.0f, 2.0f, 2.5f, 0.4f, 2.1f,
+	2.1f, 1.9f, 0.1f, 2.0f, 1.8f, 1.9f, 2.0f, 0.9f,
+	0.7f, 2.0f, 1.8f, -1.0f, 2.0f, 1.9f, -0.6f, 1.1f,
+	1.1f, 0.8f, -0.9f, 2.0f, 0.8f, 1.8f, 2.0f, 0.9f,
+	-0.3f, 2.0f, 0.7f, -0.3f, 2.0f, 1.9f, 0.1f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.7f, 1.4f, -0.3f, 2.0f, 1.4f, 1.4f, 2.0f, 0.4f,
+	0.3f, 2.0f, 1.3f, -1.5f, 2.0f, 1.5f, -1.1f, 0.7f,
+	2.7f, 1.9f, 1.1f, 2.0f, 1.8f, 1.9f, 2.0f, 0.9f,
+	1.7f, 2.0f, 2.4f, 0.0f, 2.0f, 1.9f, 0.4f, 1.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	1.1f, 0.8f, -0.9f, 2.0f, 0.8f, 1.8f, 2.0f, 0.9f,
+	-0.3f, 2.0f, 0.7f, -0.3f, 2.0f, 1.9f, 0.1f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.5f, 1.2f, -0.5f, 2.0f, 1.2f, 1.8f, 2.0f, 0.8f,
+	0.1f, 2.0f, 1.1f, -0.7f, 2.0f, 1.9f, -0.3f, 1.5f,
+	1.6f, 0.3f, 0.4f, 2.0f, 0.3f, 1.3f, 2.0f, 0.4f,
+	1.0f, 2.0f, 1.2f, -2.6f, 2.0f, 1.4f, -2.2f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.9f, 1.1f, 2.0f, 1.8f, 1.9f, 2.0f, 0.9f,
+	1.7f, 2.0f, 2.4f, 0.0f, 2.0f, 1.9f, 0.4f, 1.1f,
+	0.3f, -0.9f, -0.9f, 2.0f, -1.0f, 0.1f, 2.0f, -0.9f,
+	-0.3f, 2.0f, 0.0f, -3.9f, 2.0f, 0.1f, -3.5f, 0.1f,
+	2.3f, 1.0f, 1.1f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f,
+	1.7f, 2.0f, 1.9f, -0.1f, 2.0f, 1.1f, 0.3f, 0.3f,
+	2.0f, 1.9f, 1.0f, 2.0f, 2.4f, 2.8f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.8f, 0.3f, 2.0f, 2.7f, 1.8f, 2.2f,
+	2.0f, 1.9f, 1.0f, 2.0f, 2.4f, 2.2f, 2.0f, 2.1f,
+	1.0f, 2.0f, 1.8f, -0.7f, 2.0f, 2.1f, 0.8f, 1.2f,
+	1.0f, 0.9f, 0.0f, 2.0f, 1.3f, 2.2f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.7f, 0.1f, 2.0f, 2.0f, 1.6f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.6f, 1.5f, 0.6f, 2.0f, 1.9f, 1.8f, 2.0f, 1.6f,
+	0.6f, 2.0f, 1.3f, -1.1f, 2.0f, 1.6f, 0.4f, 0.7f,
+	2.6f, 1.9f, 2.0f, 2.0f, 2.4f, 2.2f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.4f, 0.3f, 2.0f, 2.1f, 1.8f, 1.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	1.0f, 0.9f, 0.0f, 2.0f, 1.3f, 2.2f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.7f, 0.1f, 2.0f, 2.0f, 1.6f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.4f, 1.3f, 0.4f, 2.0f, 1.7f, 2.2f, 2.0f, 2.0f,
+	0.4f, 2.0f, 1.1f, -0.3f, 2.0f, 2.0f, 1.2f, 1.5f,
+	1.5f, 0.4f, 1.3f, 2.0f, 0.8f, 1.7f, 2.0f, 1.5f,
+	1.3f, 2.0f, 1.2f, -2.2f, 2.0f, 1.5f, -0.7f, 1.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.6f, 1.9f, 2.0f, 2.0f, 2.4f, 2.2f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.4f, 0.3f, 2.0f, 2.1f, 1.8f, 1.2f,
+	0.2f, -0.9f, 0.0f, 2.0f, -0.4f, 0.4f, 2.0f, 0.3f,
+	0.0f, 2.0f, 0.0f, -3.5f, 2.0f, 0.3f, -2.0f, 0.2f,
+	2.2f, 1.1f, 2.0f, 2.0f, 1.5f, 1.4f, 2.0f, 1.2f,
+	2.0f, 2.0f, 1.9f, 0.3f, 2.0f, 1.2f, 1.8f, 0.3f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 2.1f, 0.3f, 2.0f, 2.5f, 1.3f, 1.7f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 2.1f, 1.1f, 2.0f, 2.2f, 2.0f, 2.0f, 2.0f,
+	1.1f, 2.0f, 1.6f, -0.1f, 2.0f, 2.0f, 0.9f, 1.2f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.9f, 0.9f, 2.0f, 2.0f, 2.4f, 2.0f, 2.4f,
+	0.9f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.7f, 2.0f,
+	2.2f, 1.0f, 1.8f, 2.0f, 1.1f, 1.9f, 2.0f, 1.9f,
+	1.8f, 2.0f, 1.5f, -1.2f, 2.0f, 1.9f, -0.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	1.0f, -0.3f, 0.5f, 2.0f, -0.2f, 0.7f, 2.0f, 0.7f,
+	0.5f, 2.0f, 0.3f, -2.5f, 2.0f, 0.7f, -1.5f, 0.7f,
+	2.9f, 1.7f, 2.5f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	2.5f, 2.0f, 2.2f, 1.3f, 2.0f, 1.6f, 2.3f, 0.8f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 2.5f, 1.2f, 1.9f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.9f, 1.3f, 2.0f, 2.3f, 2.3f, 2.0f, 2.3f,
+	1.3f, 2.0f, 1.7f, -0.5f, 2.0f, 2.0f, 0.8f, 1.5f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.7f, 1.1f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.1f, 2.0f, 1.5f, 0.3f, 2.0f, 2.4f, 1.6f, 2.3f,
+	2.2f, 0.8f, 2.0f, 2.0f, 1.2f, 2.2f, 2.0f, 2.2f,
+	2.0f, 2.0f, 1.6f, -1.6f, 2.0f, 1.9f, -0.3f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	1.0f, -0.5f, 0.7f, 2.0f, 0.0f, 1.0f, 2.0f, 1.0f,
+	0.7f, 2.0f, 0.3f, -2.9f, 2.0f, 0.7f, -1.6f, 0.9f,
+	2.9f, 1.5f, 2.7f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	2.7f, 2.0f, 2.3f, 0.9f, 2.0f, 1.6f, 2.2f, 1.1f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 2.1f, 0.3f, 2.0f, 2.5f, 1.3f, 1.7f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 2.1f, 1.1f, 2.0f, 2.2f, 2.0f, 2.0f, 2.0f,
+	1.1f, 2.0f, 1.6f, -0.1f, 2.0f, 2.0f, 0.9f, 1.2f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.9f, 0.9f, 2.0f, 2.0f, 2.4f, 2.0f, 2.4f,
+	0.9f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.7f, 2.0f,
+	2.2f, 1.0f, 1.8f, 2.0f, 1.1f, 1.9f, 2.0f, 1.9f,
+	1.8f, 2.0f, 1.5f, -1.2f, 2.0f, 1.9f, -0.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	1.0f, -0.3f, 0.5f, 2.0f, -0.2f, 0.7f, 2.0f, 0.7f,
+	0.5f, 2.0f, 0.3f, -2.5f, 2.0f, 0.7f, -1.5f, 0.7f,
+	2.9f, 1.7f, 2.5f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	2.5f, 2.0f, 2.2f, 1.3f, 2.0f, 1.6f, 2.3f, 0.8f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.6f, 2.2f, 1.6f, 2.0f, 2.6f, 2.6f, 2.0f, 2.6f,
+	1.6f, 2.0f, 2.0f, -0.2f, 2.0f, 2.3f, 1.1f, 1.8f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.1f, 1.5f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 1.9f, -0.3f, 2.0f, 2.2f, 1.0f, 1.7f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.6f, 1.0f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.4f, 0.3f, 2.0f, 2.4f, 1.5f, 2.2f,
+	2.3f, 0.9f, 2.1f, 2.0f, 1.3f, 2.3f, 2.0f, 2.3f,
+	2.1f, 2.0f, 1.7f, -1.5f, 2.0f, 2.0f, -0.2f, 2.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.3f, -0.1f, 1.1f, 2.0f, 0.3f, 1.3f, 2.0f, 1.3f,
+	1.1f, 2.0f, 0.7f, -2.5f, 2.0f, 1.0f, -1.2f, 1.3f,
+	2.7f, 1.2f, 2.4f, 2.0f, 1.7f, 1.7f, 2.0f, 1.7f,
+	2.4f, 2.0f, 2.0f, 0.7f, 2.0f, 1.4f, 1.9f, 0.8f,
+	2.1f, 1.9f, 0.1f, 2.0f, 1.8f, 2.5f, 2.0f, 1.5f,
+	0.7f, 2.0f, 1.8f, 0.0f, 2.0f, 2.5f, 0.4f, 2.1f,
+	2.0f, 1.7f, 0.0f, 2.0f, 1.7f, 1.7f, 2.0f, 0.7f,
+	0.6f, 2.0f, 1.6f, -1.2f, 2.0f, 1.8f, -0.8f, 1.0f,
+	0.9f, 0.6f, -1.1f, 2.0f, 0.6f, 1.6f, 2.0f, 0.7f,
+	-0.5f, 2.0f, 0.5f, -0.5f, 2.0f, 1.7f, -0.1f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.9f, 1.6f, -0.1f, 2.0f, 1.6f, 1.6f, 2.0f, 0.6f,
+	0.5f, 2.0f, 1.5f, -1.3f, 2.0f, 1.7f, -0.9f, 0.9f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	0.9f, 0.6f, -1.1f, 2.0f, 0.6f, 1.6f, 2.0f, 0.7f,
+	-0.5f, 2.0f, 0.5f, -0.5f, 2.0f, 1.7f, -0.1f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.4f, 1.2f, -0.6f, 2.0f, 1.1f, 1.8f, 2.0f, 0.8f,
+	0.0f, 2.0f, 1.1f, -0.7f, 2.0f, 1.8f, -0.3f, 1.4f,
+	1.7f, 0.4f, 0.5f, 2.0f, 0.4f, 1.4f, 2.0f, 0.5f,
+	1.1f, 2.0f, 1.3f, -2.5f, 2.0f, 1.5f, -2.1f, 1.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	0.7f, -0.5f, -0.5f, 2.0f, -0.6f, 0.5f, 2.0f, -0.5f,
+	0.1f, 2.0f, 0.4f, -3.5f, 2.0f, 0.5f, -3.1f, 0.5f,
+	2.0f, 0.8f, 0.8f, 2.0f, 0.7f, 0.8f, 2.0f, -0.2f,
+	1.5f, 2.0f, 1.7f, -0.3f, 2.0f, 0.8f, 0.1f, 0.0f,
+	2.0f, 1.9f, 1.0f, 2.0f, 2.4f, 2.8f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.8f, 0.3f, 2.0f, 2.7f, 1.8f, 2.2f,
+	1.9f, 1.8f, 0.9f, 2.0f, 2.2f, 2.1f, 2.0f, 1.9f,
+	0.9f, 2.0f, 1.6f, -0.8f, 2.0f, 1.9f, 0.7f, 1.0f,
+	0.8f, 0.7f, -0.2f, 2.0f, 1.1f, 2.0f, 2.0f, 1.8f,
+	-0.2f, 2.0f, 0.5f, -0.1f, 2.0f, 1.8f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.8f, 1.7f, 0.8f, 2.0f, 2.1f, 2.0f, 2.0f, 1.8f,
+	0.8f, 2.0f, 1.5f, -0.9f, 2.0f, 1.8f, 0.6f, 0.9f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	0.8f, 0.7f, -0.2f, 2.0f, 1.1f, 2.0f, 2.0f, 1.8f,
+	-0.2f, 2.0f, 0.5f, -0.1f, 2.0f, 1.8f, 1.4f, 1.8f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.3f, 1.2f, 0.3f, 2.0f, 1.7f, 2.1f, 2.0f, 2.0f,
+	0.3f, 2.0f, 1.1f, -0.4f, 2.0f, 2.0f, 1.1f, 1.5f,
+	1.6f, 0.5f, 1.4f, 2.0f, 0.9f, 1.8f, 2.0f, 1.6f,
+	1.4f, 2.0f, 1.3f, -2.1f, 2.0f, 1.6f, -0.6f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	0.6f, -0.5f, 0.4f, 2.0f, 0.0f, 0.8f, 2.0f, 0.7f,
+	0.4f, 2.0f, 0.4f, -3.1f, 2.0f, 0.7f, -1.6f, 0.6f,
+	1.9f, 0.8f, 1.8f, 2.0f, 1.3f, 1.1f, 2.0f, 1.0f,
+	1.8f, 2.0f, 1.7f, 0.0f, 2.0f, 1.0f, 1.6f, 0.1f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.6f, 2.4f, 1.4f, 2.0f, 2.5f, 2.3f, 2.0f, 2.3f,
+	1.4f, 2.0f, 1.9f, 0.2f, 2.0f, 2.3f, 1.2f, 1.5f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.3f, 1.3f, 2.0f, 2.4f, 2.2f, 2.0f, 2.2f,
+	1.3f, 2.0f, 1.8f, 0.1f, 2.0f, 2.2f, 1.1f, 1.4f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.8f, 0.8f, 2.0f, 1.9f, 2.4f, 2.0f, 2.4f,
+	0.8f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.6f, 2.0f,
+	2.3f, 1.1f, 1.9f, 2.0f, 1.2f, 2.0f, 2.0f, 2.0f,
+	1.9f, 2.0f, 1.6f, -1.1f, 2.0f, 2.0f, -0.1f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.3f, 0.1f, 0.9f, 2.0f, 0.2f, 1.0f, 2.0f, 1.0f,
+	0.9f, 2.0f, 0.7f, -2.1f, 2.0f, 1.0f, -1.1f, 1.1f,
+	2.7f, 1.4f, 2.2f, 2.0f, 1.5f, 1.4f, 2.0f, 1.4f,
+	2.2f, 2.0f, 2.0f, 1.1f, 2.0f, 1.4f, 2.0f, 0.6f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.6f, 2.2f, 1.6f, 2.0f, 2.6f, 2.6f, 2.0f, 2.6f,
+	1.6f, 2.0f, 2.0f, -0.2f, 2.0f, 2.3f, 1.1f, 1.8f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.1f, 1.5f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 1.9f, -0.3f, 2.0f, 2.2f, 1.0f, 1.7f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.5f, 1.1f, 0.5f, 2.0f, 1.5f, 2.5f, 2.0f, 2.5f,
+	0.5f, 2.0f, 0.9f, 0.5f, 2.0f, 2.2f, 1.8f, 2.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.6f, 1.0f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.4f, 0.3f, 2.0f, 2.4f, 1.5f, 2.2f,
+	2.3f, 0.9f, 2.1f, 2.0f, 1.3f, 2.3f, 2.0f, 2.3f,
+	2.1f, 2.0f, 1.7f, -1.5f, 2.0f, 2.0f, -0.2f, 2.3f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.3f, -0.1f, 1.1f, 2.0f, 0.3f, 1.3f, 2.0f, 1.3f,
+	1.1f, 2.0f, 0.7f, -2.5f, 2.0f, 1.0f, -1.2f, 1.3f,
+	2.7f, 1.2f, 2.4f, 2.0f, 1.7f, 1.7f, 2.0f, 1.7f,
+	2.4f, 2.0f, 2.0f, 0.7f, 2.0f, 1.4f, 1.9f, 0.8f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.6f, 2.4f, 1.4f, 2.0f, 2.5f, 2.3f, 2.0f, 2.3f,
+	1.4f, 2.0f, 1.9f, 0.2f, 2.0f, 2.3f, 1.2f, 1.5f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.5f, 2.3f, 1.3f, 2.0f, 2.4f, 2.2f, 2.0f, 2.2f,
+	1.3f, 2.0f, 1.8f, 0.1f, 2.0f, 2.2f, 1.1f, 1.4f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.5f, 1.3f, 0.3f, 2.0f, 1.4f, 2.2f, 2.0f, 2.2f,
+	0.3f, 2.0f, 0.8f, 0.9f, 2.0f, 2.2f, 1.9f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.8f, 0.8f, 2.0f, 1.9f, 2.4f, 2.0f, 2.4f,
+	0.8f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.6f, 2.0f,
+	2.3f, 1.1f, 1.9f, 2.0f, 1.2f, 2.0f, 2.0f, 2.0f,
+	1.9f, 2.0f, 1.6f, -1.1f, 2.0f, 2.0f, -0.1f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.3f, 0.1f, 0.9f, 2.0f, 0.2f, 1.0f, 2.0f, 1.0f,
+	0.9f, 2.0f, 0.7f, -2.1f, 2.0f, 1.0f, -1.1f, 1.1f,
+	2.7f, 1.4f, 2.2f, 2.0f, 1.5f, 1.4f, 2.0f, 1.4f,
+	2.2f, 2.0f, 2.0f, 1.1f, 2.0f, 1.4f, 2.0f, 0.6f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 2.5f, 1.2f, 1.9f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.9f, 1.3f, 2.0f, 2.3f, 2.3f, 2.0f, 2.3f,
+	1.3f, 2.0f, 1.7f, -0.5f, 2.0f, 2.0f, 0.8f, 1.5f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.7f, 1.1f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.1f, 2.0f, 1.5f, 0.3f, 2.0f, 2.4f, 1.6f, 2.3f,
+	2.2f, 0.8f, 2.0f, 2.0f, 1.2f, 2.2f, 2.0f, 2.2f,
+	2.0f, 2.0f, 1.6f, -1.6f, 2.0f, 1.9f, -0.3f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	1.0f, -0.5f, 0.7f, 2.0f, 0.0f, 1.0f, 2.0f, 1.0f,
+	0.7f, 2.0f, 0.3f, -2.9f, 2.0f, 0.7f, -1.6f, 0.9f,
+	2.9f, 1.5f, 2.7f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	2.7f, 2.0f, 2.3f, 0.9f, 2.0f, 1.6f, 2.2f, 1.1f,
+	2.1f, 1.9f, 0.1f, 2.0f, 1.8f, 2.5f, 2.0f, 1.5f,
+	0.7f, 2.0f, 1.8f, 0.0f, 2.0f, 2.5f, 0.4f, 2.1f,
+	2.1f, 1.9f, 0.1f, 2.0f, 1.8f, 1.9f, 2.0f, 0.9f,
+	0.7f, 2.0f, 1.8f, -1.0f, 2.0f, 1.9f, -0.6f, 1.1f,
+	1.1f, 0.8f, -0.9f, 2.0f, 0.8f, 1.8f, 2.0f, 0.9f,
+	-0.3f, 2.0f, 0.7f, -0.3f, 2.0f, 1.9f, 0.1f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.7f, 1.4f, -0.3f, 2.0f, 1.4f, 1.4f, 2.0f, 0.4f,
+	0.3f, 2.0f, 1.3f, -1.5f, 2.0f, 1.5f, -1.1f, 0.7f,
+	2.7f, 1.9f, 1.1f, 2.0f, 1.8f, 1.9f, 2.0f, 0.9f,
+	1.7f, 2.0f, 2.4f, 0.0f, 2.0f, 1.9f, 0.4f, 1.1f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.4f, 1.6f, 0.8f, 2.0f, 1.5f, 1.6f, 2.0f, 0.6f,
+	1.4f, 2.0f, 2.1f, -0.3f, 2.0f, 1.6f, 0.1f, 0.8f,
+	1.1f, 0.8f, -0.9f, 2.0f, 0.8f, 1.8f, 2.0f, 0.9f,
+	-0.3f, 2.0f, 0.7f, -0.3f, 2.0f, 1.9f, 0.1f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.5f, 1.2f, -0.5f, 2.0f, 1.2f, 1.8f, 2.0f, 0.8f,
+	0.1f, 2.0f, 1.1f, -0.7f, 2.0f, 1.9f, -0.3f, 1.5f,
+	1.6f, 0.3f, 0.4f, 2.0f, 0.3f, 1.3f, 2.0f, 0.4f,
+	1.0f, 2.0f, 1.2f, -2.6f, 2.0f, 1.4f, -2.2f, 1.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.7f, 1.9f, 1.1f, 2.0f, 1.8f, 1.9f, 2.0f, 0.9f,
+	1.7f, 2.0f, 2.4f, 0.0f, 2.0f, 1.9f, 0.4f, 1.1f,
+	0.3f, -0.9f, -0.9f, 2.0f, -1.0f, 0.1f, 2.0f, -0.9f,
+	-0.3f, 2.0f, 0.0f, -3.9f, 2.0f, 0.1f, -3.5f, 0.1f,
+	2.3f, 1.0f, 1.1f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f,
+	1.7f, 2.0f, 1.9f, -0.1f, 2.0f, 1.1f, 0.3f, 0.3f,
+	2.0f, 1.9f, 1.0f, 2.0f, 2.4f, 2.8f, 2.0f, 2.7f,
+	1.0f, 2.0f, 1.8f, 0.3f, 2.0f, 2.7f, 1.8f, 2.2f,
+	2.0f, 1.9f, 1.0f, 2.0f, 2.4f, 2.2f, 2.0f, 2.1f,
+	1.0f, 2.0f, 1.8f, -0.7f, 2.0f, 2.1f, 0.8f, 1.2f,
+	1.0f, 0.9f, 0.0f, 2.0f, 1.3f, 2.2f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.7f, 0.1f, 2.0f, 2.0f, 1.6f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.6f, 1.5f, 0.6f, 2.0f, 1.9f, 1.8f, 2.0f, 1.6f,
+	0.6f, 2.0f, 1.3f, -1.1f, 2.0f, 1.6f, 0.4f, 0.7f,
+	2.6f, 1.9f, 2.0f, 2.0f, 2.4f, 2.2f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.4f, 0.3f, 2.0f, 2.1f, 1.8f, 1.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.6f, 1.7f, 2.0f, 2.1f, 1.9f, 2.0f, 1.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 1.8f, 1.5f, 0.9f,
+	1.0f, 0.9f, 0.0f, 2.0f, 1.3f, 2.2f, 2.0f, 2.0f,
+	0.0f, 2.0f, 0.7f, 0.1f, 2.0f, 2.0f, 1.6f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	1.4f, 1.3f, 0.4f, 2.0f, 1.7f, 2.2f, 2.0f, 2.0f,
+	0.4f, 2.0f, 1.1f, -0.3f, 2.0f, 2.0f, 1.2f, 1.5f,
+	1.5f, 0.4f, 1.3f, 2.0f, 0.8f, 1.7f, 2.0f, 1.5f,
+	1.3f, 2.0f, 1.2f, -2.2f, 2.0f, 1.5f, -0.7f, 1.5f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.6f, 1.9f, 2.0f, 2.0f, 2.4f, 2.2f, 2.0f, 2.1f,
+	2.0f, 2.0f, 2.4f, 0.3f, 2.0f, 2.1f, 1.8f, 1.2f,
+	0.2f, -0.9f, 0.0f, 2.0f, -0.4f, 0.4f, 2.0f, 0.3f,
+	0.0f, 2.0f, 0.0f, -3.5f, 2.0f, 0.3f, -2.0f, 0.2f,
+	2.2f, 1.1f, 2.0f, 2.0f, 1.5f, 1.4f, 2.0f, 1.2f,
+	2.0f, 2.0f, 1.9f, 0.3f, 2.0f, 1.2f, 1.8f, 0.3f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 2.1f, 0.3f, 2.0f, 2.5f, 1.3f, 1.7f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 2.1f, 1.1f, 2.0f, 2.2f, 2.0f, 2.0f, 2.0f,
+	1.1f, 2.0f, 1.6f, -0.1f, 2.0f, 2.0f, 0.9f, 1.2f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.9f, 0.9f, 2.0f, 2.0f, 2.4f, 2.0f, 2.4f,
+	0.9f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.7f, 2.0f,
+	2.2f, 1.0f, 1.8f, 2.0f, 1.1f, 1.9f, 2.0f, 1.9f,
+	1.8f, 2.0f, 1.5f, -1.2f, 2.0f, 1.9f, -0.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	1.0f, -0.3f, 0.5f, 2.0f, -0.2f, 0.7f, 2.0f, 0.7f,
+	0.5f, 2.0f, 0.3f, -2.5f, 2.0f, 0.7f, -1.5f, 0.7f,
+	2.9f, 1.7f, 2.5f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	2.5f, 2.0f, 2.2f, 1.3f, 2.0f, 1.6f, 2.3f, 0.8f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 3.4f, 2.0f, 3.4f,
+	1.7f, 2.0f, 2.1f, 1.0f, 2.0f, 3.1f, 2.2f, 2.9f,
+	2.8f, 2.3f, 1.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	1.7f, 2.0f, 2.1f, 0.0f, 2.0f, 2.5f, 1.2f, 1.9f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 1.9f, 1.3f, 2.0f, 2.3f, 2.3f, 2.0f, 2.3f,
+	1.3f, 2.0f, 1.7f, -0.5f, 2.0f, 2.0f, 0.8f, 1.5f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.0f, 2.4f, 2.0f, 2.5f, 2.5f, 2.0f, 2.5f,
+	2.4f, 2.0f, 2.4f, 0.7f, 2.0f, 2.2f, 1.9f, 1.6f,
+	1.7f, 1.3f, 0.7f, 2.0f, 1.7f, 2.7f, 2.0f, 2.7f,
+	0.7f, 2.0f, 1.1f, 0.7f, 2.0f, 2.4f, 2.0f, 2.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.7f, 1.1f, 2.0f, 2.1f, 2.7f, 2.0f, 2.7f,
+	1.1f, 2.0f, 1.5f, 0.3f, 2.0f, 2.4f, 1.6f, 2.3f,
+	2.2f, 0.8f, 2.0f, 2.0f, 1.2f, 2.2f, 2.0f, 2.2f,
+	2.0f, 2.0f, 1.6f, -1.6f, 2.0f, 1.9f, -0.3f, 2.2f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.3f, 2.7f, 2.0f, 2.8f, 2.8f, 2.0f, 2.8f,
+	2.7f, 2.0f, 2.7f, 1.0f, 2.0f, 2.5f, 2.2f, 1.9f,
+	1.0f, -0.5f, 0.7f, 2.0f, 0.0f, 1.0f, 2.0f, 1.0f,
+	0.7f, 2.0f, 0.3f, -2.9f, 2.0f, 0.7f, -1.6f, 0.9f,
+	2.9f, 1.5f, 2.7f, 2.0f, 1.9f, 1.9f, 2.0f, 1.9f,
+	2.7f, 2.0f, 2.3f, 0.9f, 2.0f, 1.6f, 2.2f, 1.1f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 3.1f, 2.0f, 3.1f,
+	1.5f, 2.0f, 2.1f, 1.3f, 2.0f, 3.1f, 2.3f, 2.7f,
+	2.8f, 2.5f, 1.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	1.5f, 2.0f, 2.1f, 0.3f, 2.0f, 2.5f, 1.3f, 1.7f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.3f, 2.1f, 1.1f, 2.0f, 2.2f, 2.0f, 2.0f, 2.0f,
+	1.1f, 2.0f, 1.6f, -0.1f, 2.0f, 2.0f, 0.9f, 1.2f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.1f, 2.2f, 2.2f, 2.0f, 2.3f, 2.2f, 2.0f, 2.2f,
+	2.2f, 2.0f, 2.4f, 1.0f, 2.0f, 2.2f, 2.0f, 1.4f,
+	1.7f, 1.5f, 0.5f, 2.0f, 1.6f, 2.4f, 2.0f, 2.4f,
+	0.5f, 2.0f, 1.0f, 1.1f, 2.0f, 2.4f, 2.1f, 2.4f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.1f, 1.9f, 0.9f, 2.0f, 2.0f, 2.4f, 2.0f, 2.4f,
+	0.9f, 2.0f, 1.4f, 0.7f, 2.0f, 2.4f, 1.7f, 2.0f,
+	2.2f, 1.0f, 1.8f, 2.0f, 1.1f, 1.9f, 2.0f, 1.9f,
+	1.8f, 2.0f, 1.5f, -1.2f, 2.0f, 1.9f, -0.2f, 1.9f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+	3.4f, 2.5f, 2.5f, 2.0f, 2.6f, 2.5f, 2.0f, 2.5f,
+	2.5f, 2.0f, 2.7f, 1.3f, 2.0f, 2.5f, 2.3f, 1.7f,
+	1.0f, -0.3f, 0.5f, 2.0f, -0.2f, 0.7f, 2.0f, 0.7f,
+	0.5f, 2.0f, 0.3f, -2.5f, 2.0f, 0.7f, -1.5f, 0.7f,
+	2.9f, 1.7f, 2.5f, 2.0f, 1.8f, 1.6f, 2.0f, 1.6f,
+	2.5f, 2.0f, 2.2f, 1.3f, 2.0f, 1.6f, 2.3f, 0.8f,
+};
+
+
+
+constexpr float READDATA_STACK[6][6] =
+{
+	-0.9f, -2.2f, -2.1f, -1.1f, -0.6f, -1.4f, -2.1f, -3.3f,
+	-2.4f, -2.1f, -1.4f, -2.1f, -2.4f, -3.4f, -3.3f, -2.2f,
+	-1.5f, -2.5f, -1.3f, -2.4f, -2.1f, -0.9f, -1.0f, -1.3f,
+	-1.3f, -2.5f, -2.1f, -1.4f, -0.5f, 1.3f, -1.0f, -1.5f,
+	-1.4f, -0.6f, 0.3f, -0.5f,
+};
+
+
+
+constexpr float READDATA_TSTACKH[6][4][4] =
+{
+	-0.3f, -0.5f, -0.3f, -0.3f, -0.1f, -0.2f, -1.5f, -0.2f,
+	-1.1f, -1.2f, -0.2f, 0.2f, -0.3f, -0.3f, -0.6f, -1.1f,
+	-1.5f, -1.5f, -1.4f, -1.8f, -1.0f, -0.9f, -2.9f, -0.8f,
+	-2.2f, -2.0f, -1.6f, -1.1f, -1.7f, -1.4f, -1.8f, -2.0f,
+	-1.1f, -1.5f, -1.3f, -2.1f, -1.1f, -0.7f, -2.4f, -0.5f,
+	-2.4f, -2.9f, -1.4f, -1.2f, -1.9f, -1.0f, -2.2f, -1.5f,
+	-0.5f, -0.3f, -0.6f, -0.5f, -0.2f, -0.1f, -1.2f, 0.0f,
+	-1.4f, -1.2f, -0.7f, -0.2f, -0.3f, -0.1f, -0.5f, -0.8f,
+	0.2f, -0.5f, -0.3f, -0.3f, -0.1f, -0.2f, -1.5f, -0.2f,
+	-0.9f, -1.1f, -0.3f, 0.0f, -0.3f, -0.3f, -0.4f, -1.1f,
+	-0.5f, -0.3f, -0.6f, -0.5f, -0.2f, -0.1f, -1.7f, 0.0f,
+	-0.8f, -1.2f, -0.3f, -0.7f, -0.6f, -0.1f, -0.6f, -0.8f,
+};
+
+
+
+constexpr float READDATA_TSTACKI[6][4][4] =
+{
+	0.7f, 0.7f, -0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+	-0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.0f,
+	0.0f, 0.0f, -1.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	-1.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -0.7f,
+	0.0f, 0.0f, -1.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	-1.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -0.7f,
+	0.7f, 0.7f, -0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+	-0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.0f,
+	0.7f, 0.7f, -0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+	-0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.0f,
+	0.7f, 0.7f, -0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+	-0.4f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.0f,
+};
+
+
+
+constexpr float READDATA_MISCLOOP[20] =
+{
+	1.079f, 3.0f, 0.5f, 0.5f, 0.5f, 0.5f, 3.4f, 0.0f,
+	0.4f, 10.1f, -0.3f, -0.3f, 0.5f, -2.2f, 0.3f, 1.6f,
+	1.4f, 4.1f, 1.0f, 0.0f,
+};
+
+
+
+constexpr float READDATA_LOOP_HAIRPIN[31] =
+{
+	1.7014117e+38f, 1.7014117e+38f, 1.7014117e+38f, 5.7f, 5.6f, 5.6f, 5.4f, 5.9f,
+	5.6f, 6.4f, 6.5f, 6.6f, 6.7f, 6.8f, 6.9f, 6.9f,
+	7.0f, 7.1f, 7.1f, 7.2f, 7.2f, 7.3f, 7.3f, 7.4f,
+	7.4f, 7.5f, 7.5f, 7.5f, 7.6f, 7.6f, 7.7f,
+};
+
+
+
+constexpr float READDATA_LOOP_BULGE[31] =
+{
+	1.7014117e+38f, 3.8f, 2.8f, 3.2f, 3.6f, 4.0f, 4.4f, 4.6f,
+	4.7f, 4.8f, 5.7f, 5.0f, 5.1f, 5.2f, 5.3f, 5.4f,
+	5.4f, 5.5f, 5.5f, 5.6f, 1.7014117e+38f, 5.7f, 5.8f, 5.8f,
+	5.8f, 5.9f, 5.9f, 6.0f, 6.0f, 6.0f, 6.1f,
+};
+
+
+
+constexpr float READDATA_LOOP_INTERIOR[31] =
+{
+	1.7014117e+38f, 1.7014117e+38f, 1.7014117e+38f, 1.7014117e+38f, 1.7f, 1.8f, 2.0f, 2.2f,
+	2.3f, 2.4f, 2.5f, 2.6f, 2.7f, 2.8f, 2.9f, 3.0f,
+	3.0f, 3.1f, 3.1f, 3.2f, 3.3f, 3.3f, 3.4f, 3.4f,
+	3.4f, 3.5f, 3.5f, 3.6f, 3.6f, 3.6f, 3.7f,
+};
+
+
+
+constexpr float READDATA_POPPEN[5] =
+{
+	0.0f, 0.5f, 0.5f, 0.5f, 0.5f,
+};
+
+
+
+constexpr readdata_loop READDATA_TLOOP[] =
+{
+	{"AGAAAU", 2.0f},
+	{"AGCAAU", 1.5f},
+	{"AGUAAU", 1.5f},
+	{"AGUGAU", 1.5f},
+	{"CGAAAG", 3.0f},
+	{"CGAAGG", 2.5f},
+	{"CGAGAG", 2.0f},
+	{"CGCAAG", 3.0f},
+	{"CGCGAG", 2.5f},
+	{"CGGAAG", 3.0f},
+	{"CGGGAG", 1.5f},
+	{"CGUAAG", 2.0f},
+	{"CGUGAG", 3.0f},
+	{"CUAACG", 2.0f},
+	{"CUACGG", 2.5f},
+	{"CUUCGG", 3.0f},
+	{"GGAAAC", 3.0f},
+	{"GGAAGC", 1.5f},
+	{"GGAGAC", 3.0f},
+	{"GGCAAC", 2.5f},
+	{"GGCGAC", 1.5f},
+	{"GGGAAC", 1.5f},
+	{"GGGAGC", 1.5f},
+	{"GGGGAC", 3.0f},
+	{"GUGAAC", 1.5f},
+	{"UGAAAA", 1.5f},
+	{"UGAAAG", 2.0f},
+	{"UGAGAG", 2.5f},
+	{"UGGAAA", 1.5f},
+	{nullptr, 0.0f}
+};
+
+
+
+constexpr readdata_loop READDATA_TRILOOP[] =
+{
+	{nullptr, 0.0f}
+};
+
+
+
+constexpr unsigned int READDATA_MINIMAL_HAIRPIN_LENGTH = 3;
+
+
+
+#endif	// READDATATABLES_HPP
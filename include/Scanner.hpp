@@ -0,0 +1,89 @@
+/**
+ * @file include/Scanner.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+
+#ifndef SCANNER_HPP
+#define	SCANNER_HPP
+
+
+#include "main.hpp"
+
+
+#define SCANNER_CHUNK_FACTOR 16// A chunk of about this many window sizes is folded at once
+
+
+
+/**
+ * @brief Folds overlapping windows of long (genomic) sequences on both strands
+ *
+ * @section DESCRIPTION
+ * The windows of WINDOW nucleotides start every STEP nucleotides; the
+ * last window is cut off at the end of the sequence. For every window
+ * a BED record is written to the output as soon as it is folded:
+ *
+ * <PRE>
+ * name	start	end	dE	segments	strand	structure
+ * </PRE>
+ *
+ * where start and end are 0-based and half-open on the forward strand,
+ * dE is the minimum free energy in kcal/mol and the structure is given
+ * from the 5' end of the window on its own strand. In energy only mode
+ * the structure column is left out.
+ *
+ * A pair within a window spans less than WINDOW nucleotides, and V(i,j)
+ * only depends on the pairs within (i,j). The windows therefore are not
+ * folded one by one: consecutive windows are folded as one chunk with
+ * a maximum span of WINDOW - 1, so the cells shared by the windows of a
+ * chunk are calculated once. Only the exterior loop and the traceback
+ * are done per window. Consecutive chunks overlap by WINDOW - STEP
+ * nucleotides, of which the cells are calculated again.
+ */
+class Scanner
+{
+	private:
+		Settings &settings;
+		ReadData &thermodynamics;
+		std::ostream &output;
+		
+		size_t window_size;
+		size_t window_step;
+		size_t max_span;
+		size_t windows_per_chunk;
+		
+		template <class Engine> void scan_strand(std::string &arg_name, Sequence &arg_sequence, char arg_strand);
+		void write_record(std::string &arg_name, size_t arg_start, size_t arg_end, float arg_energy, unsigned int arg_segments, char arg_strand, std::string &arg_structure);
+		
+	public:
+		Scanner(Settings &arg_settings, ReadData &arg_thermodynamics, std::ostream &arg_output);
+		
+		template <class Engine> void scan(std::string &arg_name, Sequence &arg_sequence);
+};
+
+
+#endif	// SCANNER_HPP
@@ -0,0 +1,107 @@
+/**
+ * @file include/Scheduler.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+#ifndef SCHEDULER_HPP
+#define	SCHEDULER_HPP
+
+
+#include "main.hpp"
+
+
+#define SCHEDULER_CHUNK_SIZE 4096
+
+
+
+/**
+ * @brief A single FASTA record and, once folded, its formatted 2D structure
+ */
+struct scheduler_job
+{
+	std::string name;
+	Sequence sequence;
+	std::string output;
+};
+
+
+
+/**
+ * @brief Folds a single job with one of the Zuker engines
+ */
+typedef void (*scheduler_fold_function)(Settings &job_settings, scheduler_job &job, ReadData &thermodynamics);
+
+
+
+/**
+ * @brief Folds the records of the input concurrently (inter-sequence parallelism)
+ *
+ * @section DESCRIPTION
+ * Records are read in chunks of SCHEDULER_CHUNK_SIZE. Within a chunk
+ * the longest sequences are folded first, each by its own Zuker object
+ * (and thus its own ScoringMatrix objects). The thermodynamic
+ * parameters and segments are shared read-only by all threads. The
+ * output is printed in the order of the input.
+ *
+ * A chunk with only one record is folded outside of the parallel
+ * region, with the parallelism inside Zuker::energy() instead.
+ *
+ * The Zuker engine is selected once per chunk, so that folding without
+ * segments (-p 0) does not look them up for every pair.
+ *
+ * In scanning mode (-w) the records are scanned one after another by
+ * the Scanner, which writes its records directly to the output.
+ */
+class Scheduler
+{
+	private:
+		Settings &settings;
+		Sequence &sequence;
+		ReadData &thermodynamics;
+		
+		bool exhausted;
+		
+		bool read_chunk(std::vector<scheduler_job> &jobs);
+		
+		template <class Engine> static void fold_job(Settings &job_settings, scheduler_job &job, ReadData &thermodynamics);
+		template <class Engine> static void scan_job(Settings &job_settings, scheduler_job &job, ReadData &thermodynamics);
+		template <bool Segments, bool SegmentLoops> scheduler_fold_function select_engine(bool constant_hairpin);
+		scheduler_fold_function select_engine(void);
+		
+	public:
+		Scheduler(Settings &arg_settings, Sequence &arg_sequence, ReadData &arg_thermodynamics);
+		
+		size_t chunk_size;
+		
+		void fold(std::vector<scheduler_job> &jobs);
+		void fold(std::vector<scheduler_job> &jobs, scheduler_fold_function fold_job);
+		void scan(std::vector<scheduler_job> &jobs);
+		void run(void);
+};
+
+
+#endif	// SCHEDULER_HPP
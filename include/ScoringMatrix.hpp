@@ -33,6 +33,53 @@
 
 #include "main.hpp"
 
+#include "ScoringMatrixLayout.hpp"
+
+
+/**
+ * @brief Contiguous positions of a row or column of a ScoringMatrix
+ *
+ * @section DESCRIPTION
+ * Obtained by ScoringMatrix::row_span() or ScoringMatrix::column_span(),
+ * so that inner loops index a plain array instead of calculating the
+ * position of every element. The span holds the elements first ...
+ * first + length - 1; in a banded column the rows before the band are
+ * not part of it. Only checks its bounds in DEBUG mode.
+ */
+template <class T>
+class ScoringMatrixSpan
+{
+	public:
+		T *data;///< Element first
+		size_t first;
+		size_t length;
+		
+		inline T &operator[](size_t k)
+		{
+#if DEBUG
+			if(k < this->first || k >= this->first + this->length)
+			{
+				throw std::invalid_argument("ScoringMatrixSpan::operator[]: Out of bound (" + std::to_string(k) + ")");
+			}
+#endif //DEBUG
+			return this->data[k - this->first];
+		}
+		
+		/**
+		 * @brief Returns a pointer to element k, of which the elements k ... k + n - 1 must be within the span
+		 */
+		inline T *range(size_t k, size_t n)
+		{
+#if DEBUG
+			if(k < this->first || k + n > this->first + this->length)
+			{
+				throw std::invalid_argument("ScoringMatrixSpan::range: Out of bound (" + std::to_string(k) + ", " + std::to_string(n) + ")");
+			}
+#endif //DEBUG
+			return this->data + (k - this->first);
+		}
+};
+
 
 /**
  * @brief A (memory efficient) lower triangle of an n*n scoring matrix plus an additional vertical.
@@ -57,18 +104,37 @@
 [   ][ i ][ i ][ s ][ s ]
 [   ][   ][ i ][ i ][ s ]
 [   ][   ][   ][ i ][ i ]
+
+The order in which the positions are stored is given by the Layout
+policy: ScoringMatrixRowLayout (default) or ScoringMatrixDiagonalLayout.
+
+Optionally a column-major copy is kept, in which column j holds
+(0,j) ... (j,j) contiguously. It is written by set() and makes the
+columns, which are strided in the matrix itself, unit-stride.
+
+Optionally only a band of the matrix is stored: the positions with
+j - i <= max_span. This takes O(n * max_span) instead of O(n * n)
+memory; the positions outside the band hold the initialization value
+and can not be set.
  */
-template <class T>
+template <class T, class Layout = ScoringMatrixRowLayout>
 class ScoringMatrix
 {
 	private:
 		size_t grid_size;
+		size_t max_span;///< Largest j - i that is stored; n - 1 if the entire triangle is stored
 		
 		T initialization_value;
 		std::vector<T> m;
+		bool transposed_copy;
+		std::vector<T> m_transposed;///< Optional column-major copy of m, including the diagonal
+		
+		size_t column_start(size_t j);
 		
 	public:
 		ScoringMatrix(size_t arg_length, T arg_initialization_value);///@todo use size_t instead of unsigned int?
+		ScoringMatrix(size_t arg_length, T arg_initialization_value, bool arg_transposed_copy);
+		ScoringMatrix(size_t arg_length, T arg_initialization_value, bool arg_transposed_copy, size_t arg_max_span);
 		
 		signed int get_position(Pair &p);
 		
@@ -76,8 +142,18 @@ class ScoringMatrix
 		
 		void set(Pair &p, T arg_value);
 		
+		T *row(size_t i);
+		void get_column(size_t j, size_t i_begin, size_t i_end, T *output);
+		
+		bool has_transposed_copy(void);
+		T *column(size_t j);
+		
+		ScoringMatrixSpan<T> row_span(size_t i);
+		ScoringMatrixSpan<T> column_span(size_t j);
+		
 		size_t size(void);
 		size_t number_of_elements(size_t n);
+		size_t get_max_span(void);
 		
 		///@todo Nucleotide operator[](size_t); << directly obtain from the vector this->m, allows caching of its iterator
 		
@@ -0,0 +1,141 @@
+/**
+ * @file include/ScoringMatrixLayout.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCORINGMATRIXLAYOUT_HPP
+#define	SCORINGMATRIXLAYOUT_HPP
+
+
+
+#include "main.hpp"
+
+
+
+/**
+ * @brief Layout policy of ScoringMatrix that stores the upper triangle row after row
+ *
+ * @section DESCRIPTION
+ * Row i holds (i,i+1) ... (i,n-1) contiguously, which is what
+ * ScoringMatrix::row() and ScoringMatrix::row_span() require. The
+ * distance between (i,j) and (i+1,j) is n - i - 2.
+ *
+ * <PRE>
+ * [ - ][ 0 ][ 1 ][ 2 ][ 3 ]
+ * [   ][ - ][ 4 ][ 5 ][ 6 ]
+ * [   ][   ][ - ][ 7 ][ 8 ]
+ * [   ][   ][   ][ - ][ 9 ]
+ * [   ][   ][   ][   ][ - ]
+ * </PRE>
+ *
+ * A band of width w only stores j - i <= w; row i then holds
+ * min(w, n - i - 1) positions. With w = n - 1 the band is the entire
+ * triangle. For n = 5 and w = 2:
+ *
+ * <PRE>
+ * [ - ][ 0 ][ 1 ][   ][   ]
+ * [   ][ - ][ 2 ][ 3 ][   ]
+ * [   ][   ][ - ][ 4 ][ 5 ]
+ * [   ][   ][   ][ - ][ 6 ]
+ * [   ][   ][   ][   ][ - ]
+ * </PRE>
+ */
+class ScoringMatrixRowLayout
+{
+	public:
+		static const bool contiguous_rows = true;
+		
+		/**
+		 * @brief Position of (i,j), i < j <= i + w, in a matrix of n*n with a band of width w
+		 */
+		static inline size_t position(size_t n, size_t w, size_t i, size_t j)
+		{
+			size_t full_rows = n - 1 - w;// rows of w positions
+			size_t r = n - i - 1;
+			
+			if(i < full_rows)
+			{
+				return i * w + (j - i - 1);
+			}
+			
+			return full_rows * w + ((w + 1) * w) / 2 - ((r + 1) * r) / 2 + (j - i - 1);
+		}
+		
+		/**
+		 * @brief Number of positions in a matrix of n*n with a band of width w < n
+		 */
+		static inline size_t size(size_t n, size_t w)
+		{
+			return (n - 1 - w) * w + ((w + 1) * w) / 2;
+		}
+};
+
+
+
+/**
+ * @brief Layout policy of ScoringMatrix that stores the upper triangle diagonal after diagonal
+ *
+ * @section DESCRIPTION
+ * Diagonal d = j - i holds (0,d) ... (n-d-1,n-1) contiguously. This is
+ * the order in which a fill without tiles calculates the positions:
+ * neighbouring positions of one diagonal share cache lines, and (i+1,j)
+ * and (i,j-1) are adjacent on the previous diagonal. Rows are not
+ * contiguous, so row() and row_span() are not available.
+ *
+ * <PRE>
+ * [ - ][ 0 ][ 4 ][ 7 ][ 9 ]
+ * [   ][ - ][ 1 ][ 5 ][ 8 ]
+ * [   ][   ][ - ][ 2 ][ 6 ]
+ * [   ][   ][   ][ - ][ 3 ]
+ * [   ][   ][   ][   ][ - ]
+ * </PRE>
+ *
+ * A band of width w simply ends after diagonal w.
+ */
+class ScoringMatrixDiagonalLayout
+{
+	public:
+		static const bool contiguous_rows = false;
+		
+		/**
+		 * @brief Position of (i,j), i < j <= i + w, in a matrix of n*n with a band of width w
+		 */
+		static inline size_t position(size_t n, size_t w, size_t i, size_t j)
+		{
+			size_t d = j - i;
+			
+			return (d - 1) * n - (d * (d - 1)) / 2 + i;
+		}
+		
+		/**
+		 * @brief Number of positions in a matrix of n*n with a band of width w < n
+		 */
+		static inline size_t size(size_t n, size_t w)
+		{
+			return w * n - ((w + 1) * w) / 2;
+		}
+};
+
+
+
+#endif	// SCORINGMATRIXLAYOUT_HPP
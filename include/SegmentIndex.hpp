@@ -0,0 +1,83 @@
+/**
+ * @file include/SegmentIndex.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+#ifndef SEGMENTINDEX_HPP
+#define	SEGMENTINDEX_HPP
+
+
+#include "main.hpp"
+#include "Pair.hpp"
+#include "PackedSequence.hpp"
+
+
+
+/**
+ * @brief A segment that fits in between the pairs (i,j) and p2 = (i',j') of a particular sequence
+ */
+struct segment_candidate
+{
+	unsigned int j;
+	Pair p2;
+	Segment *segment;
+};
+
+
+
+/**
+ * @brief Per sequence index of all locations where a segment can be folded
+ *
+ * @section DESCRIPTION
+ * A segment can only be folded in between the pairs (i,j) and (i',j')
+ * if its 5' sequence is found at [i+1, i'-1] and its 3' sequence at
+ * [j'+1, j-1]. The sequence is scanned once for the occurrences of
+ * all 5' and 3' sequences of the segments, and the combinations that
+ * are enclosed by two canonical pairs are stored per i.
+ *
+ * The candidates of (i,j) are sorted by i' ascending and then by j'
+ * descending, which is the order in which Zuker::v() enumerates the
+ * interior loops.
+ */
+class SegmentIndex
+{
+	private:
+		std::vector<std::vector<segment_candidate>> candidates;
+		
+		void find_occurrences(PackedSequence &arg_sequence, Sequence &arg_pattern, std::vector<unsigned int> &arg_occurrences);
+		
+	public:
+		SegmentIndex(Sequence &arg_sequence, SegmentTree &arg_segments);
+		SegmentIndex(Sequence &arg_sequence, SegmentTree &arg_segments, size_t arg_max_span);
+		
+		void search(Pair &p1, std::vector<segment_candidate>::iterator &arg_begin, std::vector<segment_candidate>::iterator &arg_end);
+		
+		size_t size(void);
+};
+
+
+#endif	// SEGMENTINDEX_HPP
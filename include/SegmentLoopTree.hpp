@@ -30,6 +30,7 @@
 
 
 #include "SubSequence.hpp"
+#include "PackedSequence.hpp"
 
 
 
@@ -49,12 +50,30 @@ struct SegmentLoopTreeElement
 
 
 
+/**
+ * @brief Bucket of the segmentloop hash table; the sequence is packed 2 bits per nucleotide
+ */
+struct segmentloop_table_entry
+{
+	uint64_t key;
+	size_t size;
+	
+	SegmentLoop *segmentloop;///< nullptr if the bucket is empty
+};
+
+
+
 /**
  * @brief Stores and provides access to (K-loop) segmentloop objects and provides extended trace-back routes for such segments.
  *
  * @section DESCRIPTION
  * Stores all (K-turn) segments in memory.
  *
+ * Zuker::v() searches every span, while nearly all spans have a length
+ * that no segmentloop has. Such spans are rejected by a lookup in the
+ * set of loaded lengths. The remaining spans cost a single probe in a
+ * hash table keyed on their packed sequence; only spans too long to be
+ * packed walk the tree.
  */
 class SegmentLoopTree
 {
@@ -63,6 +82,19 @@ class SegmentLoopTree
 	private:
 		SegmentLoopTreeElement *root;//@todo move back to private
 		
+		std::vector<bool> lengths;///< lengths[n] is true if a segmentloop of n nucleotides is present
+		
+		std::vector<segmentloop_table_entry> table;
+		size_t table_mask;
+		size_t table_used;
+		
+		void table_insert(SegmentLoop *arg_segmentloop);
+		void table_rehash(size_t arg_size);
+		
+		SegmentLoop *table_search(uint64_t arg_key, size_t arg_size);
+		
+		static size_t hash(uint64_t arg_key, size_t arg_size);
+		
 		void insert(SegmentLoop &arg_segment, SegmentLoopTreeElement *arg_element);
 		SegmentLoop *search(SubSequence &arg_segment, SegmentLoopTreeElement *arg_element);
 		
@@ -75,6 +107,7 @@ class SegmentLoopTree
 		
 		void insert(SegmentLoop &arg_segment);
 		SegmentLoop *search(SubSequence &arg_segment);
+		SegmentLoop *search(PackedSequence &arg_sequence, size_t arg_start, size_t arg_size);
 		
 		bool empty(void);
 		size_t size(void);
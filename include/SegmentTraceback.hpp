@@ -91,6 +91,8 @@ class SegmentTraceback
 		
 	public:
 		SegmentTraceback(std::vector<Pair> arg_bonds);
+		SegmentTraceback(const SegmentTraceback &arg_traceback);
+		SegmentTraceback &operator=(const SegmentTraceback &arg_traceback);
 		
 		bool traceback(unsigned int &i, unsigned int &j);
 		void reset(void);
@@ -0,0 +1,101 @@
+/**
+ * @file include/SegmentTracebackTable.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef SEGMENTTRACEBACKTABLE_HPP
+#define	SEGMENTTRACEBACKTABLE_HPP
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "SegmentTraceback.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif //_OPENMP
+
+
+
+/**
+ * @brief Bucket of the segment traceback table; (i,j) packed into a single key
+ */
+struct segment_traceback_table_entry
+{
+	uint64_t key;
+	SegmentTraceback *segment_traceback;
+};
+
+
+
+/**
+ * @brief Sparse replacement of a ScoringMatrix<SegmentTraceback *>; only positions where a Segment or SegmentLoop was chosen are stored.
+ *
+ * @section DESCRIPTION
+ * Open-addressing (linear probing) table keyed on (i,j), kept at most
+ * half full. Positions that were never set return nullptr, like the
+ * initialization value of the dense matrix did.
+ *
+ * set() may be called concurrently by the threads filling the matrices;
+ * insertions are serialized with a lock of the table itself, so that
+ * the tables of sequences folded concurrently do not wait for each
+ * other. This is cheap because a Segment only rarely wins. get() takes
+ * no lock and may only be used when no thread is writing, i.e. after
+ * the fill.
+ */
+class SegmentTracebackTable
+{
+	private:
+		std::vector<segment_traceback_table_entry> table;
+		size_t table_mask;
+		size_t table_used;
+		
+#ifdef _OPENMP
+		omp_lock_t lock;
+#endif //_OPENMP
+		
+		static uint64_t key(Pair &p);
+		static size_t hash(uint64_t arg_key);
+		
+		void insert(uint64_t arg_key, SegmentTraceback *arg_segment_traceback);
+		void rehash(size_t arg_size);
+		
+	public:
+		SegmentTracebackTable(void);
+		SegmentTracebackTable(const SegmentTracebackTable &arg_table);
+		~SegmentTracebackTable(void);
+		
+		SegmentTracebackTable &operator=(const SegmentTracebackTable &arg_table);
+		
+		SegmentTraceback *get(Pair &p);
+		void set(Pair &p, SegmentTraceback *arg_segment_traceback);
+		
+		size_t size(void);
+		void clear(void);
+};
+
+#endif	// SEGMENTTRACEBACKTABLE_HPP
@@ -28,20 +28,54 @@
 #define	SEGMENTTREE_HPP
 
 
+#include "Direction.hpp"
 #include "SubSequence.hpp"
 
 
+/**
+ * @brief Bucket of the flat segment table; both arms are packed 2 bits per nucleotide
+ */
+struct segment_table_entry
+{
+	uint64_t key_5p;
+	uint64_t key_3p;
+	
+	unsigned char size_5p;
+	unsigned char size_3p;
+	
+	Segment *segment;///< nullptr if the bucket is empty
+};
+
+
 /**
  * @brief Stores and provides access to (K-Turn) segment objects and provides extended trace-back routes for such segments.
  *
  * @section DESCRIPTION
- * Stores all (K-turn) segments in memory.
+ * Stores all (K-turn) segments in memory. Next to the tree, which guards
+ * against duplicates and serves arms that are too long to be packed,
+ * every segment is stored in a flat open-addressing table keyed on its
+ * 2-bit packed 5' and 3' sequences. Lookups probe this contiguous table
+ * instead of chasing the pointers of the tree. The table is filled by
+ * insert() only, so once ReadSegments::parse() is done it can be shared
+ * read-only between folding threads.
  */
 class SegmentTree
 {
 	private:
 		SegmentTreeElement *root;
 		
+		size_t max_size_5p;
+		size_t max_size_3p;
+		
+		std::vector<segment_table_entry> table;
+		size_t table_mask;
+		size_t table_used;
+		
+		void table_insert(Segment *arg_segment);
+		void table_rehash(size_t arg_size);
+		
+		static size_t hash(uint64_t arg_key_5p, uint64_t arg_key_3p, size_t arg_size_5p, size_t arg_size_3p);
+		
 	public:
 		SegmentTree();
 		~SegmentTree();
@@ -49,9 +83,12 @@ class SegmentTree
 		void insert(Segment &arg_segment);
 		
 		Segment *search(SubSequence &arg_segment5p, SubSequence &arg_segment3p);
+		void get_segments(std::vector<Segment *> &arg_segments);
 		
 		bool empty(void);
 		size_t size(void);
+		
+		size_t max_size(Direction direction);
 };
 
 
@@ -62,6 +62,8 @@ class SegmentTreeElement
 		void add_segment(Segment &arg_segment);
 		Segment *search_segment(SubSequence &arg_sequence_5p, SubSequence &arg_sequence_3p);
 		
+		void get_segments(std::vector<Segment *> &arg_segments);
+		
 		size_t size(void);
 };
 
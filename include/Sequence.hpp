@@ -60,6 +60,7 @@ class Sequence
 		bool empty();
 		
 		Sequence subseq(size_t arg_start, size_t arg_stop);
+		Sequence reverse_complement(void);
 		SubSequence ssubseq(size_t arg_start, size_t arg_stop);
 		
 		std::string str();
@@ -49,9 +49,11 @@ class Settings
 		char **argv;
 		
 		Sequence &obj_sequence;
+		FILE *sequence_stream;///< Stream of the FASTA input that may contain more records; nullptr if there are none
 		
 		void parse_arguments(void);
-		void parse_sequence_from_stream(FILE *stream);
+		bool parse_sequence_from_stream(FILE *stream);
+		void close_sequence_stream(void);
 		
 		std::vector<std::string> get_share_directories(void);
 		void get_segments_file(void);
@@ -63,10 +65,21 @@ class Settings
 	public:
 		Settings(int arg_argc, char **arg_argv, Sequence &arg_sequence);
 		
+		bool next_sequence(void);
+		
+		std::string sequence_name;
 		unsigned int num_threads;
+		unsigned int tile_size;
 		unsigned int minimal_hairpin_length;
+		unsigned int maximal_loop_length;
+		unsigned int maximal_pair_span;///< Largest j - i of a pair; 0 for no limit
+		unsigned int window_size;///< Size of the scanning windows; 0 to fold the entire sequences
+		unsigned int window_step;///< Distance between the scanning windows; 0 for half the window size
 		bool segment_prediction_functionality;
 		std::string segment_filename;
+		std::string parameter_filename;///< Binary parameter file; empty for the compiled parameters
+		bool energy_only;///< Only calculate the minimum free energy; no traceback matrices and no structure
+		bool traceback_recomputation;///< Trace back by recomputing the decompositions instead of storing them in traceback matrices
 		
 		bool proceed_with_folding;
 		
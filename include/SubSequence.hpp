@@ -34,6 +34,9 @@
 #include "Position.hpp"
 
 
+#define SUBSEQUENCE_MAX_PACKED_SIZE 32///< Subsequences up to this length fit 2 bits per nucleotide into a 64-bit key
+
+
 /**
  * @brief Pointer based subsequence of a Sequence to avoid deep-copying
  *
@@ -57,6 +60,8 @@ class SubSequence
 		void init(void);
 		
 		Nucleotide operator[](size_t);
+		
+		uint64_t pack(void);
 };
 
 #endif	// SUBSEQUENCE_HPP
@@ -0,0 +1,101 @@
+/**
+ * @file include/TracebackMatrix.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef TRACEBACKMATRIX_HPP
+#define	TRACEBACKMATRIX_HPP
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "ScoringMatrix.hpp"
+#include "ZukerTraceback.hpp"
+
+
+
+#define TRACEBACKMATRIX_NARROW_MAX_SIZE 255     // n * (n + 1) must fit in an uint16_t
+#define TRACEBACKMATRIX_WIDE_MAX_SIZE   65535   // n * (n + 1) must fit in an uint32_t
+
+#define TRACEBACKMATRIX_END             0       // End of line; no jump
+#define TRACEBACKMATRIX_V_SELF          1       // Jump to the same position in the V matrix
+#define TRACEBACKMATRIX_OFFSET          2       // First value of the bifurcations
+
+
+
+/**
+ * @brief Compact lower triangle of traceback_jumps; 2 bytes per position for short sequences and 4 bytes otherwise.
+ *
+ * @section DESCRIPTION
+ * A traceback_jump stores two positions and a matrix flag, which pads
+ * to 12 bytes. Within one traceback matrix the target of a jump from
+ * (i,j) can only be one of the following, so it is stored as a single
+ * number relative to (i,j) instead, with s = j - i:
+ *
+ * <PRE>
+ * 0                                 end of line (UNBOUND)
+ * 1                                 (i,j) in the V matrix
+ * 2 + (k - i)                       bifurcation at k in the bifurcation matrix
+ * 2 + s + di * (s + 1) + dj         (i + di, j - dj) in the matrix itself
+ * max                               NOT_YET_CALCULATED
+ * </PRE>
+ *
+ * The largest value is (s + 1) * (s + 2) <= n * (n + 1), which fits in
+ * 16 bits for sequences up to 255 nucleotides and in 32 bits for
+ * sequences up to 65535 nucleotides. When only a band of spans s <=
+ * max_span is stored, the width depends on max_span + 1 instead of n.
+ */
+class TracebackMatrix
+{
+	private:
+		char matrix;///< Matrix the jumps within this matrix target: V_MATRIX, W_MATRIX or WM_MATRIX
+		char bifurcation_matrix;///< Matrix bifurcations continue in
+		
+		bool wide;
+		
+		ScoringMatrix<uint16_t> narrow_m;
+		ScoringMatrix<uint32_t> wide_m;
+		
+		static bool is_wide(size_t arg_length);
+		
+		uint32_t encode(Pair &p, traceback_jump &arg_jump);
+		traceback_jump decode(Pair &p, uint32_t value);
+		
+	public:
+		TracebackMatrix(size_t arg_length, char arg_matrix, char arg_bifurcation_matrix);
+		TracebackMatrix(size_t arg_length, char arg_matrix, char arg_bifurcation_matrix, size_t arg_max_span);
+		
+		traceback_jump get(Pair &p);
+		void set(Pair &p, traceback_jump arg_jump);
+		
+		void fill(traceback_jump arg_jump);
+		
+		size_t size(void);
+		size_t bytes_per_element(void);
+};
+
+#endif	// TRACEBACKMATRIX_HPP
@@ -36,14 +36,16 @@
 #include "Utils/utils.hpp"
 
 
-#define V_MATRIX 1
-#define W_MATRIX 2
-#define WM_MATRIX 3
-
-
-
 #include "ZukerTraceback.hpp"
+#include "TracebackMatrix.hpp"
+#include "SegmentTracebackTable.hpp"
+#include "SegmentIndex.hpp"
 #include "GibbsFreeEnergy.hpp"
+#include "Energy.hpp"
+#include "ZukerFeatures.hpp"
+
+
+#define ZUKER_INTERIOR_BLOCK 64// Number of j' per interior loop batch in v()
 
 
 /**
@@ -54,13 +56,39 @@
  * The program implements the Zuker's minimum Gibbs free energy energy
  * model with Segments/K-turns functionality for RNA secondary structure
  * prediction.
+ *
+ * The arithmetic of the matrices is given by the Energy policy:
+ * FloatEnergy (kcal/mol in floats) or FixedPointEnergy (dcal/mol in
+ * 32-bit integers). The elements provided by GibbsFreeEnergy are
+ * converted with Energy::from_kcal() as they enter the recursions.
+ * Zuker is the float engine, which is the one used by the program.
+ *
+ * The Features policy (ZukerFeatures) removes the segment lookups and
+ * the runtime minimal hairpin length from the recursions; the
+ * Scheduler selects the instantiation that matches the settings and
+ * the loaded segments.
+ *
+ * With a maximum base pair span L (settings.maximal_pair_span) only the
+ * band j - i <= L of the matrices is stored and filled, and W(0,n-1) is
+ * replaced by the exterior loop recursion over the prefixes of the
+ * sequence. That takes O(n * L) instead of O(n * n) memory.
+ *
+ * Once filled, the structure of any window of the sequence in which no
+ * pair exceeds the span can be obtained from the same matrices with
+ * energy(begin, end) and traceback().
  */
-class Zuker: public GibbsFreeEnergy
+template <class Energy, class Features = ZukerFeatures<true, true> >
+class ZukerEngine: public GibbsFreeEnergy
 {
 		friend class Test_Zuker;
 		
+	public:
+		typedef typename Energy::type energy_type;
+		
 	private:
 		Settings &settings;
+		bool store_traceback;///< Whether the traceback matrices are filled; not in energy only mode or with traceback by recomputation
+		size_t max_span;///< Largest j - i of a pair; 0 if the entire matrices are filled
 		
 		std::vector<traceback_jump> traceback_stack;
 		int traceback_stacktop;
@@ -68,37 +96,78 @@ class Zuker: public GibbsFreeEnergy
 		
 		Position sequence_begin;
 		
+		// Part of the sequence of which the structure is given; the entire sequence or a window
+		size_t structure_begin;
+		size_t structure_end;
+		
+		static size_t pair_span(Settings &arg_settings, Sequence &arg_sequence);
+		
+		void fill_elements(void);
+		void energy_tile(size_t tile_i, size_t tile_j, size_t tile_size);
+		void energy_exterior(void);
+		energy_type structure_energy(void);
+		void fill_v(Pair &p1);
+		
+		inline unsigned int minimal_hairpin_length(void)
+		{
+			return (Features::minimal_hairpin_length >= 0) ? (unsigned int) Features::minimal_hairpin_length : (unsigned int) this->settings.minimal_hairpin_length;
+		}
+		
+		// Decompositions; only read from the matrices
+		energy_type v_decompose(Pair &p1, PairingPlus &p1p, traceback_jump &arg_jump, SegmentTraceback *&arg_segment_traceback);
+		energy_type w_decompose(Pair &p1, traceback_jump &arg_jump);
+		energy_type wm_decompose(Pair &p1, traceback_jump &arg_jump);
+		energy_type exterior_decompose(size_t j, traceback_jump &arg_jump);
+		
+		std::vector<energy_type> v_column;///< Column of V read by exterior_decompose()
+		
+		traceback_jump traceback_action(traceback_jump &origin, SegmentTraceback *&arg_segment_traceback);
+		
 	public:
-		Zuker(Settings &arg_settings, Sequence &arg_sequence, ReadData &arg_thermodynamics);
+		ZukerEngine(Settings &arg_settings, Sequence &arg_sequence, ReadData &arg_thermodynamics);
 		
 		DotBracket dot_bracket;
 		
 		// Energy per structure functions:
-		float energy(void);// Fills the V and W matrices
+		float energy(void);// Fills the V and W matrices; returns kcal/mol
+		float energy(size_t begin, size_t end);// Of the window begin...end-1, after energy(); returns kcal/mol
 		
 		// Energy functions:
-		float v(Pair &p1, PairingPlus &p1p);
-		float w(Pair &p1);
-		float wm(Pair &p1, PairingPlus &p1p);
+		energy_type v(Pair &p1, PairingPlus &p1p);
+		energy_type w(Pair &p1);
+		energy_type wm(Pair &p1);
 		
 		// Trace-back related:
 		void traceback(void);
+		void traceback_exterior(void);
 		void traceback_push(traceback_jump arg_jump);
 		bool traceback_pop(unsigned int &i, unsigned int &j, char &matrix);
+		unsigned int get_folded_segments(void);
 		
 		// Output functions
+		void format_2D_structure(std::string &output);
 		void print_2D_structure(void);
 		
-		// Energy matrices
-		ScoringMatrix<float> vij;//paired matrix
-		ScoringMatrix<float> wij;//unpaired matrix
-		ScoringMatrix<float> wmij;//multiloop matrix
+		// Energy matrices; with a maximum span only their band is stored and W is left empty
+		ScoringMatrix<energy_type> vij;//paired matrix
+		ScoringMatrix<energy_type> wij;//unpaired matrix; with column-major copy for the bifurcations
+		ScoringMatrix<energy_type> wmij;//multiloop matrix; with column-major copy for the bifurcations
 		
-		// Traceback matrices
-		ScoringMatrix<traceback_jump> tij_v;
-		ScoringMatrix<traceback_jump> tij_w;
-		ScoringMatrix<traceback_jump> tij_wm;
-		ScoringMatrix<SegmentTraceback *> sij;
+		// Only with a maximum span, which replaces W; element j is the energy of 0...j-1
+		std::vector<energy_type> exterior;
+		
+		// Elements of V that only depend on (i,j), precomputed per sequence
+		ScoringMatrix<energy_type> hairpin_elements;
+		ScoringMatrix<energy_type> stacking_elements;
+		
+		// Traceback matrices; empty in energy only mode and with traceback by recomputation
+		TracebackMatrix tij_v;
+		TracebackMatrix tij_w;
+		TracebackMatrix tij_wm;
+		SegmentTracebackTable sij;// only the positions where a Segment or SegmentLoop was chosen
+		
+		// Locations of segments within the sequence
+		SegmentIndex segment_index;
 		
 #if DEBUG
 		// Functions only useful for plotting and debugging
@@ -110,6 +179,11 @@ class Zuker: public GibbsFreeEnergy
 
 
 
+typedef ZukerEngine<FloatEnergy> Zuker;
+typedef ZukerEngine<FixedPointEnergy> FixedPointZuker;
+
+
+
 ///@brief Friend class of Zuker that allows testing its private members
 class Test_Zuker: public Zuker
 {
@@ -0,0 +1,58 @@
+/**
+ * @file include/ZukerFeatures.hpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZUKERFEATURES_HPP
+#define	ZUKERFEATURES_HPP
+
+
+#define ZUKER_CONSTANT_HAIRPIN_LENGTH 3///< default of -H, compiled into the most used Zuker engines
+
+
+
+/**
+ * @brief Policy of Zuker that fixes the optional parts of the recursions at compile time
+ *
+ * @section DESCRIPTION
+ * Without Segments, Zuker::v() does not look up the segment candidates
+ * and bounds the interior loops by the maximal loop length only.
+ * Without SegmentLoops, it does not search the SegmentLoopTree for
+ * every pair. The engine must only be used for folding with an empty
+ * SegmentTree and SegmentLoopTree respectively.
+ *
+ * A MinimalHairpinLength of 0 or more replaces the runtime
+ * settings.minimal_hairpin_length; -1 uses the runtime setting.
+ */
+template <bool Segments, bool SegmentLoops, int MinimalHairpinLength = -1>
+class ZukerFeatures
+{
+	public:
+		static const bool segments = Segments;
+		static const bool segmentloops = SegmentLoops;
+		static const int minimal_hairpin_length = MinimalHairpinLength;
+};
+
+
+
+#endif	// ZUKERFEATURES_HPP
@@ -35,6 +35,11 @@
 #include "Pair.hpp"
 
 
+#define V_MATRIX 1
+#define W_MATRIX 2
+#define WM_MATRIX 3
+
+
 
 
 /**
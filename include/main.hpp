@@ -36,12 +36,14 @@
 #include <stdarg.h>
 #include <stdexcept>
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string>
 #include <string.h>
 #include <time.h>
 #include <unistd.h>
 #include <limits.h>
+#include <limits>
 #include <algorithm>
 #include <string>
 #include <vector>
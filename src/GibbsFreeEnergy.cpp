@@ -30,6 +30,8 @@
 #include "Pairing.hpp"
 #include "PairingPlus.hpp"
 #include "Sequence.hpp"
+#include "PackedSequence.hpp"
+#include "PairingMatrix.hpp"
 
 #include "Direction.hpp"
 #include "Pair.hpp"
@@ -53,14 +55,59 @@
  *
  */
 GibbsFreeEnergy::GibbsFreeEnergy(Sequence &arg_sequence, ReadData &arg_thermodynamics) :
+	GibbsFreeEnergy(arg_sequence, arg_thermodynamics, 0)
+{
+}
+
+
+
+/**
+ * @brief Constructor that only indexes the pairs (i,j) with j - i <= arg_max_span
+ *
+ * @param arg_max_span Largest j - i that can pair; 0 for no limit
+ */
+GibbsFreeEnergy::GibbsFreeEnergy(Sequence &arg_sequence, ReadData &arg_thermodynamics, size_t arg_max_span) :
 	sequence(arg_sequence),
-	thermodynamics(arg_thermodynamics)
+	thermodynamics(arg_thermodynamics),
+	packed_sequence(arg_sequence),
+	pairings(arg_sequence, arg_max_span)
 {
 	this->interpolate_loop_hairpin();
 	this->interpolate_loop_bulge();
 	this->interpolate_loop_interior();
 	
 	this->interpolate_loop_hairpin_C_penalty();
+	
+	this->pack_loop_table(this->thermodynamics.triloop_map, 5, this->triloop_table);
+	this->pack_loop_table(this->thermodynamics.tloop_map, 6, this->tloop_table);
+}
+
+
+
+/**
+ * @brief Converts a map of loop sequences into a table indexed by their packed keys
+ *
+ * @section DESCRIPTION
+ * Hairpin loops are looked up by the packed key of (i..j), which avoids
+ * allocating a Sequence and walking the map for every hairpin. The
+ * table is private to this object, so it reflects the maps as they were
+ * when folding started and is not shared between threads.
+ *
+ * @param arg_size The length of the loops including the closing pair; entries of another length can never be looked up and are skipped
+ */
+void GibbsFreeEnergy::pack_loop_table(std::map<Sequence, float> &arg_map, size_t arg_size, std::vector<float> &arg_table)
+{
+	arg_table.assign((size_t) 1 << (2 * arg_size), 0.0f);
+	
+	for(std::map<Sequence, float>::iterator it = arg_map.begin(); it != arg_map.end(); ++it)
+	{
+		Sequence loop = it->first;
+		
+		if(loop.size() == arg_size)
+		{
+			arg_table[SubSequence(loop.data.begin(), loop.data.end() - 1, arg_size).pack()] = it->second;
+		}
+	}
 }
 
 
@@ -145,20 +192,11 @@ inline float GibbsFreeEnergy::get_miscloop(unsigned char arg_param)
 /**
  * @brief Returns the Gibbs Free Energy of a tloop
  *
+ * @param arg_pair The pair closing the loop of 4 unpaired nucleotides
  */
-inline float GibbsFreeEnergy::get_tloop(Sequence &arg_subsequence)
+inline float GibbsFreeEnergy::get_tloop(Pair &arg_pair)
 {
-	std::map<Sequence, float>::const_iterator search = this->thermodynamics.tloop_map.find(arg_subsequence);
-	
-	///@todo write as one liner () t ? f :
-	if(search != this->thermodynamics.tloop_map.end())
-	{
-		return search->second;
-	}
-	else
-	{
-		return 0.0;
-	}
+	return this->tloop_table[this->packed_sequence.key(arg_pair.first, 6)];
 }
 
 
@@ -166,20 +204,11 @@ inline float GibbsFreeEnergy::get_tloop(Sequence &arg_subsequence)
 /**
  * @brief Returns the Gibbs Free Energy of a triloop
  *
+ * @param arg_pair The pair closing the loop of 3 unpaired nucleotides
  */
-inline float GibbsFreeEnergy::get_triloop(Sequence &arg_subsequence)
+inline float GibbsFreeEnergy::get_triloop(Pair &arg_pair)
 {
-	std::map<Sequence, float>::const_iterator search = this->thermodynamics.triloop_map.find(arg_subsequence);
-	
-	///@todo write as oneliner () t ? f :
-	if(search != this->thermodynamics.triloop_map.end())
-	{
-		return search->second;
-	}
-	else
-	{
-		return 0.0;
-	}
+	return this->triloop_table[this->packed_sequence.key(arg_pair.first, 5)];
 }
 
 
@@ -465,8 +494,9 @@ inline void GibbsFreeEnergy::interpolate_loop_interior()
  * vector should be empty at startup
  * the third position (4th pos in vector) probably differs so much from interpolation that a separate variable was chosen
  *
- * @todo optimize possibly overwritten values
- *
+ * The table is only written to when it has to grow, so that Zuker
+ * objects for sequences that fit within the table can be constructed
+ * concurrently.
  */
 inline void GibbsFreeEnergy::interpolate_loop_hairpin_C_penalty()
 {
@@ -477,14 +507,17 @@ inline void GibbsFreeEnergy::interpolate_loop_hairpin_C_penalty()
 	{
 		n -= 2;
 		
-		this->thermodynamics.loop_hairpin_C_penalty.reserve(n);				// reserve should be used, and during the for loop it should be filled using push_backs
+		if(this->thermodynamics.loop_hairpin_C_penalty.size() <= n)
+		{
+			this->thermodynamics.loop_hairpin_C_penalty.reserve(n);			// reserve should be used, and during the for loop it should be filled using push_backs
+		}
 		
 		for(i = this->thermodynamics.loop_hairpin_C_penalty.size(); i <= n; i++)
 		{
 			this->thermodynamics.loop_hairpin_C_penalty.push_back(this->get_miscloop(MISCLOOP_C_HAIRPIN_INTERCEPT) + ((float) i * this->get_miscloop(MISCLOOP_C_HAIRPIN_SLOPE)));
 		}
 		
-		if(n >= 4)
+		if(n >= 4 && this->thermodynamics.loop_hairpin_C_penalty[3] != this->get_miscloop(MISCLOOP_C_HAIRPIN_OF_3))
 		{
 			this->thermodynamics.loop_hairpin_C_penalty[3] = this->get_miscloop(MISCLOOP_C_HAIRPIN_OF_3);
 		}
@@ -580,18 +613,12 @@ float GibbsFreeEnergy::get_hairpin_loop_element(Pair &arg_pair)
 		switch(n_unpaired)
 		{
 			case 3:
-				{
-					Sequence sub_sequence = this->sequence.subseq(arg_pair.first, arg_pair.second);
-					///@todo AU penalty?
-					energy += this->get_triloop(sub_sequence);
-					break;
-				}
+				///@todo AU penalty?
+				energy += this->get_triloop(arg_pair);
+				break;
 			case 4:
-				{
-					Sequence sub_sequence = this->sequence.subseq(arg_pair.first, arg_pair.second);
-					energy += this->get_tloop(sub_sequence);
-					break;
-				}
+				energy += this->get_tloop(arg_pair);
+				break;
 		}
 		
 		energy += this->get_poly_C_loop_penalty(arg_pair, n_unpaired);
@@ -603,6 +630,125 @@ float GibbsFreeEnergy::get_hairpin_loop_element(Pair &arg_pair)
 
 
 
+/**
+ * @brief Finds the stacking elements of all pairs (i,j) with j > i in a single row
+ *
+ * @section DESCRIPTION
+ * Equal to get_stacking_pair_element() for every (i,j), but without
+ * building Pairing objects; the PairingTypes are looked up in the
+ * PairingMatrix.
+ *
+ * @param arg_i Position i in the sequence
+ * @param arg_length Number of elements; at most sequence.size() - i - 1
+ * @param arg_row Output of arg_length elements; element k is the energy of (i, i + 1 + k)
+ */
+void GibbsFreeEnergy::get_stacking_pair_elements(size_t arg_i, size_t arg_length, float *arg_row)
+{
+	size_t length = arg_length;
+	
+	for(size_t k = 0; k < length; k++)
+	{
+		size_t j = arg_i + 1 + k;
+		
+		if(k < 3 || !this->pairings.is_canonical(arg_i, j))
+		{
+			arg_row[k] = N_INFINITY;
+		}
+		else
+		{
+			arg_row[k] = this->thermodynamics.stack[this->pairings.type(arg_i, j)][this->pairings.type(arg_i + 1, j - 1)];
+		}
+	}
+}
+
+
+
+/**
+ * @brief Finds the hairpin loop elements of all pairs (i,j) with j > i in a single row
+ *
+ * @section DESCRIPTION
+ * Equal to get_hairpin_loop_element() for every canonical (i,j); the
+ * other positions are N_INFINITY. Element k closes a loop of k unpaired
+ * nucleotides, so the loop size and poly-C terms are added as whole
+ * rows of their tables. The terms are added in the same order as in
+ * get_hairpin_loop_element(), which keeps the sums bit-exact equal.
+ *
+ * The poly-C penalty only depends on i: get_poly_C_loop_penalty() only
+ * inspects the first unpaired nucleotide. The GGG part of the GGG-U
+ * penalty only depends on i as well.
+ *
+ * @param arg_i Position i in the sequence
+ * @param arg_length Number of elements; at most sequence.size() - i - 1
+ * @param arg_row Output of arg_length elements; element k is the energy of (i, i + 1 + k)
+ */
+void GibbsFreeEnergy::get_hairpin_loop_elements(size_t arg_i, size_t arg_length, float *arg_row)
+{
+	size_t length = arg_length;
+	size_t k;
+	
+	const Nucleotide *s = this->sequence.data.data();
+	
+	// Loop size
+	const float *loop_hairpin = this->thermodynamics.loop_hairpin.data();
+	for(k = 0; k < length; k++)
+	{
+		arg_row[k] = loop_hairpin[k];
+	}
+	
+	// Terminal mismatch
+	for(k = 0; k < length; k++)
+	{
+		size_t j = arg_i + 1 + k;
+		if(this->pairings.is_canonical(arg_i, j))
+		{
+			arg_row[k] += this->thermodynamics.tstackh[this->pairings.type(arg_i, j)][s[arg_i + 1]][s[j - 1]];
+		}
+	}
+	
+	// Loop-sequence specific penalty
+	if(length > 3)
+	{
+		arg_row[3] += this->triloop_table[this->packed_sequence.key(arg_i, 5)];
+	}
+	if(length > 4)
+	{
+		arg_row[4] += this->tloop_table[this->packed_sequence.key(arg_i, 6)];
+	}
+	
+	// Poly-C penalty
+	if(length > 0 && s[arg_i + 1] == Nucleotide::C)
+	{
+		const float *loop_hairpin_C_penalty = this->thermodynamics.loop_hairpin_C_penalty.data();
+		for(k = 0; k < length; k++)
+		{
+			arg_row[k] += loop_hairpin_C_penalty[k];
+		}
+	}
+	
+	// GGG-U penalty
+	if(arg_i >= 2 && s[arg_i] == Nucleotide::G && s[arg_i - 1] == Nucleotide::G && s[arg_i - 2] == Nucleotide::G)
+	{
+		float penalty = this->get_miscloop(MISCLOOP_GGG_U_PENALTY);
+		for(k = 0; k < length; k++)
+		{
+			if(s[arg_i + 1 + k] == Nucleotide::U)
+			{
+				arg_row[k] += penalty;
+			}
+		}
+	}
+	
+	for(k = 0; k < length; k++)
+	{
+		if(k < this->thermodynamics.minimal_hairpin_length || !this->pairings.is_canonical(arg_i, arg_i + 1 + k))
+		{
+			arg_row[k] = N_INFINITY;
+		}
+	}
+}
+
+
+
 /**
  * @brief Energy function for Bulge Loop
  *
@@ -905,6 +1051,70 @@ float GibbsFreeEnergy::get_interior_loop_element(Region &arg_region)
 
 
 
+/**
+ * @brief Finds the interior loop elements of (i,j) with (i',j') for one i' and a batch of j'
+ *
+ * @section DESCRIPTION
+ * Element m is equal to get_interior_loop_element() for (i,j) and
+ * (i', arg_jp[m]). Only the 1x1, 1x2, 2x1 and 2x2 loops go through
+ * get_interior_loop_element(). For the other loops the terminal mismatch
+ * of (i,j) is looked up once per batch and every element costs one table
+ * lookup per term, added in the same order as in
+ * get_interior_loop_element() so that the sums are bit-exact equal.
+ *
+ * @param arg_p1 Outer pair (i,j)
+ * @param arg_ip Position i'
+ * @param arg_jp Positions j' that pair with i', with i' < j' < j - 1
+ * @param arg_n Number of positions
+ * @param arg_elements Output of arg_n elements
+ */
+void GibbsFreeEnergy::get_interior_loop_elements(Pair &arg_p1, size_t arg_ip, const size_t *arg_jp, size_t arg_n, float *arg_elements)
+{
+	const Nucleotide *s = this->sequence.data.data();
+	
+	unsigned int l1 = (unsigned int)(arg_ip - arg_p1.first - 1);
+	unsigned int l2;
+	size_t jp;
+	
+	float tstki_ij = this->thermodynamics.tstki[this->pairings.type(arg_p1.first, arg_p1.second)][s[arg_p1.first + 1]][s[arg_p1.second - 1]];
+	float asymmetric_max = this->get_miscloop(MISCLOOP_ASYMETRIC_INTENRAL_LOOP);
+	unsigned int poppen_size = (unsigned int) this->thermodynamics.poppen_p.size();
+	
+	const float *loop_interior = this->thermodynamics.loop_interior.data();
+	const float *poppen = this->thermodynamics.poppen_p.data();
+	
+	float energy;
+	
+	for(size_t m = 0; m < arg_n; m++)
+	{
+		jp = arg_jp[m];
+		l2 = (unsigned int)(arg_p1.second - 1 - jp);
+		
+		if(jp - arg_ip - 1 <= this->thermodynamics.minimal_hairpin_length)
+		{
+			energy = N_INFINITY;
+		}
+		else if(l1 + l2 <= 4 && l1 <= l2 + 1 && l2 <= l1 + 1)
+		{
+			Pair p2 = Pair((unsigned int) arg_ip, (unsigned int) jp);
+			Region region = Region {arg_p1, p2};
+			energy = this->get_interior_loop_element(region);
+		}
+		else
+		{
+			energy = 0.0;
+			energy += loop_interior[l1 + l2];
+			energy += tstki_ij;
+			energy += this->thermodynamics.tstki[this->pairings.type(jp, arg_ip)][s[jp + 1]][s[arg_ip - 1]];
+			energy += std::min(asymmetric_max, (float) abs((signed int) l1 - (signed int) l2) * poppen[std::min(poppen_size, std::min(l1, l2) + 1) - 1]);
+		}
+		
+		arg_elements[m] = energy;
+	}
+}
+
+
+
 /**
  * @brief Finds a possible AU Gibbs free energy penalty for a Stacking element.
  *
@@ -0,0 +1,438 @@
+/**
+ * @file src/MinPlus.cpp
+ *
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#include "main.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MINPLUS_X86 1
+#include <immintrin.h>
+#else
+#define MINPLUS_X86 0
+#endif
+
+#include "MinPlus.hpp"
+
+
+
+/**
+ * @brief Reference kernel; used for the remainders of the vectorized kernels and on other CPUs
+ *
+ * @return Whether energy and argmin were updated
+ */
+bool MinPlus::scalar(const float *a, const float *b, size_t n, float &energy, size_t &argmin)
+{
+	bool found = false;
+	
+	for(size_t k = 0; k < n; k++)
+	{
+		float tmp = a[k] + b[k];
+		if(tmp < energy)
+		{
+			energy = tmp;
+			argmin = k;
+			found = true;
+		}
+	}
+	
+	return found;
+}
+
+
+/**
+ * @brief Reference kernel for energies in dcal/mol
+ *
+ * @return Whether energy and argmin were updated
+ */
+bool MinPlus::scalar(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin)
+{
+	bool found = false;
+	
+	for(size_t k = 0; k < n; k++)
+	{
+		int32_t tmp = a[k] + b[k];
+		if(tmp < energy)
+		{
+			energy = tmp;
+			argmin = k;
+			found = true;
+		}
+	}
+	
+	return found;
+}
+
+
+
+#if MINPLUS_X86
+/**
+ * @brief Kernel of 4 floats per step
+ */
+__attribute__((target("sse2")))
+bool MinPlus::sse2(const float *a, const float *b, size_t n, float &energy, size_t &argmin)
+{
+	size_t blocks = n / 4 * 4;
+	
+	if(blocks == 0)
+	{
+		return MinPlus::scalar(a, b, n, energy, argmin);
+	}
+	
+	__m128 lane_energy = _mm_set1_ps(energy);
+	__m128i lane_argmin = _mm_set1_epi32(-1);
+	__m128i k = _mm_setr_epi32(0, 1, 2, 3);
+	__m128i step = _mm_set1_epi32(4);
+	
+	for(size_t i = 0; i < blocks; i += 4)
+	{
+		__m128 tmp = _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+		__m128 smaller = _mm_cmplt_ps(tmp, lane_energy);
+		
+		lane_energy = _mm_or_ps(_mm_and_ps(smaller, tmp), _mm_andnot_ps(smaller, lane_energy));
+		lane_argmin = _mm_or_si128(_mm_and_si128(_mm_castps_si128(smaller), k), _mm_andnot_si128(_mm_castps_si128(smaller), lane_argmin));
+		k = _mm_add_epi32(k, step);
+	}
+	
+	float lane_energies[4];
+	int32_t lane_argmins[4];
+	_mm_storeu_ps(lane_energies, lane_energy);
+	_mm_storeu_si128((__m128i *) lane_argmins, lane_argmin);
+	
+	bool found = false;
+	for(size_t lane = 0; lane < 4; lane++)
+	{
+		if(lane_argmins[lane] >= 0 && (!found || lane_energies[lane] < energy || (lane_energies[lane] == energy && (size_t) lane_argmins[lane] < argmin)))
+		{
+			energy = lane_energies[lane];
+			argmin = (size_t) lane_argmins[lane];
+			found = true;
+		}
+	}
+	
+	size_t tail_argmin;
+	if(MinPlus::scalar(a + blocks, b + blocks, n - blocks, energy, tail_argmin))
+	{
+		argmin = blocks + tail_argmin;
+		found = true;
+	}
+	
+	return found;
+}
+
+
+
+/**
+ * @brief Kernel of 8 floats per step
+ */
+__attribute__((target("avx2")))
+bool MinPlus::avx2(const float *a, const float *b, size_t n, float &energy, size_t &argmin)
+{
+	size_t blocks = n / 8 * 8;
+	
+	if(blocks == 0)
+	{
+		return MinPlus::sse2(a, b, n, energy, argmin);
+	}
+	
+	__m256 lane_energy = _mm256_set1_ps(energy);
+	__m256i lane_argmin = _mm256_set1_epi32(-1);
+	__m256i k = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i step = _mm256_set1_epi32(8);
+	
+	for(size_t i = 0; i < blocks; i += 8)
+	{
+		__m256 tmp = _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+		__m256 smaller = _mm256_cmp_ps(tmp, lane_energy, _CMP_LT_OQ);
+		
+		lane_energy = _mm256_blendv_ps(lane_energy, tmp, smaller);
+		lane_argmin = _mm256_blendv_epi8(lane_argmin, k, _mm256_castps_si256(smaller));
+		k = _mm256_add_epi32(k, step);
+	}
+	
+	float lane_energies[8];
+	int32_t lane_argmins[8];
+	_mm256_storeu_ps(lane_energies, lane_energy);
+	_mm256_storeu_si256((__m256i *) lane_argmins, lane_argmin);
+	
+	bool found = false;
+	for(size_t lane = 0; lane < 8; lane++)
+	{
+		if(lane_argmins[lane] >= 0 && (!found || lane_energies[lane] < energy || (lane_energies[lane] == energy && (size_t) lane_argmins[lane] < argmin)))
+		{
+			energy = lane_energies[lane];
+			argmin = (size_t) lane_argmins[lane];
+			found = true;
+		}
+	}
+	
+	size_t tail_argmin;
+	if(MinPlus::sse2(a + blocks, b + blocks, n - blocks, energy, tail_argmin))
+	{
+		argmin = blocks + tail_argmin;
+		found = true;
+	}
+	
+	return found;
+}
+
+
+/**
+ * @brief Kernel of 4 integers per step
+ */
+__attribute__((target("sse2")))
+bool MinPlus::sse2(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin)
+{
+	size_t blocks = n / 4 * 4;
+	
+	if(blocks == 0)
+	{
+		return MinPlus::scalar(a, b, n, energy, argmin);
+	}
+	
+	__m128i lane_energy = _mm_set1_epi32(energy);
+	__m128i lane_argmin = _mm_set1_epi32(-1);
+	__m128i k = _mm_setr_epi32(0, 1, 2, 3);
+	__m128i step = _mm_set1_epi32(4);
+	
+	for(size_t i = 0; i < blocks; i += 4)
+	{
+		__m128i tmp = _mm_add_epi32(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i)));
+		__m128i smaller = _mm_cmplt_epi32(tmp, lane_energy);
+		
+		lane_energy = _mm_or_si128(_mm_and_si128(smaller, tmp), _mm_andnot_si128(smaller, lane_energy));
+		lane_argmin = _mm_or_si128(_mm_and_si128(smaller, k), _mm_andnot_si128(smaller, lane_argmin));
+		k = _mm_add_epi32(k, step);
+	}
+	
+	int32_t lane_energies[4];
+	int32_t lane_argmins[4];
+	_mm_storeu_si128((__m128i *) lane_energies, lane_energy);
+	_mm_storeu_si128((__m128i *) lane_argmins, lane_argmin);
+	
+	bool found = false;
+	for(size_t lane = 0; lane < 4; lane++)
+	{
+		if(lane_argmins[lane] >= 0 && (!found || lane_energies[lane] < energy || (lane_energies[lane] == energy && (size_t) lane_argmins[lane] < argmin)))
+		{
+			energy = lane_energies[lane];
+			argmin = (size_t) lane_argmins[lane];
+			found = true;
+		}
+	}
+	
+	size_t tail_argmin;
+	if(MinPlus::scalar(a + blocks, b + blocks, n - blocks, energy, tail_argmin))
+	{
+		argmin = blocks + tail_argmin;
+		found = true;
+	}
+	
+	return found;
+}
+
+
+
+/**
+ * @brief Kernel of 8 integers per step
+ */
+__attribute__((target("avx2")))
+bool MinPlus::avx2(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin)
+{
+	size_t blocks = n / 8 * 8;
+	
+	if(blocks == 0)
+	{
+		return MinPlus::sse2(a, b, n, energy, argmin);
+	}
+	
+	__m256i lane_energy = _mm256_set1_epi32(energy);
+	__m256i lane_argmin = _mm256_set1_epi32(-1);
+	__m256i k = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i step = _mm256_set1_epi32(8);
+	
+	for(size_t i = 0; i < blocks; i += 8)
+	{
+		__m256i tmp = _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)(a + i)), _mm256_loadu_si256((const __m256i *)(b + i)));
+		__m256i smaller = _mm256_cmpgt_epi32(lane_energy, tmp);
+		
+		lane_energy = _mm256_blendv_epi8(lane_energy, tmp, smaller);
+		lane_argmin = _mm256_blendv_epi8(lane_argmin, k, smaller);
+		k = _mm256_add_epi32(k, step);
+	}
+	
+	int32_t lane_energies[8];
+	int32_t lane_argmins[8];
+	_mm256_storeu_si256((__m256i *) lane_energies, lane_energy);
+	_mm256_storeu_si256((__m256i *) lane_argmins, lane_argmin);
+	
+	bool found = false;
+	for(size_t lane = 0; lane < 8; lane++)
+	{
+		if(lane_argmins[lane] >= 0 && (!found || lane_energies[lane] < energy || (lane_energies[lane] == energy && (size_t) lane_argmins[lane] < argmin)))
+		{
+			energy = lane_energies[lane];
+			argmin = (size_t) lane_argmins[lane];
+			found = true;
+		}
+	}
+	
+	size_t tail_argmin;
+	if(MinPlus::sse2(a + blocks, b + blocks, n - blocks, energy, tail_argmin))
+	{
+		argmin = blocks + tail_argmin;
+		found = true;
+	}
+	
+	return found;
+}
+#else //MINPLUS_X86
+bool MinPlus::sse2(const float *a, const float *b, size_t n, float &energy, size_t &argmin)
+{
+	return MinPlus::scalar(a, b, n, energy, argmin);
+}
+
+
+
+bool MinPlus::avx2(const float *a, const float *b, size_t n, float &energy, size_t &argmin)
+{
+	return MinPlus::scalar(a, b, n, energy, argmin);
+}
+
+
+bool MinPlus::sse2(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin)
+{
+	return MinPlus::scalar(a, b, n, energy, argmin);
+}
+
+
+
+bool MinPlus::avx2(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin)
+{
+	return MinPlus::scalar(a, b, n, energy, argmin);
+}
+#endif //MINPLUS_X86
+
+
+
+/**
+ * @brief Whether the CPU supports SSE2
+ */
+bool MinPlus::has_sse2(void)
+{
+#if MINPLUS_X86
+	return __builtin_cpu_supports("sse2");
+#else //MINPLUS_X86
+	return false;
+#endif //MINPLUS_X86
+}
+
+
+
+/**
+ * @brief Whether the CPU supports AVX2
+ */
+bool MinPlus::has_avx2(void)
+{
+#if MINPLUS_X86
+	return __builtin_cpu_supports("avx2");
+#else //MINPLUS_X86
+	return false;
+#endif //MINPLUS_X86
+}
+
+
+
+/**
+ * @brief Selects the widest kernel supported by the CPU
+ */
+min_plus_kernel MinPlus::select(void)
+{
+	if(MinPlus::has_avx2())
+	{
+		return &MinPlus::avx2;
+	}
+	else if(MinPlus::has_sse2())
+	{
+		return &MinPlus::sse2;
+	}
+	
+	return &MinPlus::scalar;
+}
+
+
+
+/**
+ * @brief Selects the widest integer kernel supported by the CPU
+ */
+min_plus_kernel_int32 MinPlus::select_int32(void)
+{
+	if(MinPlus::has_avx2())
+	{
+		return &MinPlus::avx2;
+	}
+	else if(MinPlus::has_sse2())
+	{
+		return &MinPlus::sse2;
+	}
+	
+	return &MinPlus::scalar;
+}
+
+
+
+/**
+ * @brief Finds the first k for which a[k] + b[k] is minimal, if it is smaller than energy
+ *
+ * @param a First operands; n elements
+ * @param b Second operands; n elements
+ * @param n Number of elements
+ * @param energy Current minimum; updated if a smaller sum is found
+ * @param argmin Set to the position of the smaller sum, if one is found
+ *
+ * @return Whether energy and argmin were updated
+ */
+bool MinPlus::reduce(const float *a, const float *b, size_t n, float &energy, size_t &argmin)
+{
+	static const min_plus_kernel kernel = MinPlus::select();
+	
+	return kernel(a, b, n, energy, argmin);
+}
+
+
+
+/**
+ * @brief Finds the first k for which a[k] + b[k] is minimal, if it is smaller than energy; energies in dcal/mol
+ *
+ * @return Whether energy and argmin were updated
+ */
+bool MinPlus::reduce(const int32_t *a, const int32_t *b, size_t n, int32_t &energy, size_t &argmin)
+{
+	static const min_plus_kernel_int32 kernel = MinPlus::select_int32();
+	
+	return kernel(a, b, n, energy, argmin);
+}
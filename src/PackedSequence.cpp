@@ -0,0 +1,102 @@
+/**
+ * @file src/PackedSequence.cpp
+ *
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "main.hpp"
+
+#include "Nucleotide.hpp"
+#include "Position.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+#include "PackedSequence.hpp"
+
+
+
+/**
+ * @brief Packs all nucleotides of a sequence
+ *
+ * @section DESCRIPTION
+ * One trailing word is always present, so that key() may read the word
+ * following the one in which a window starts.
+ */
+PackedSequence::PackedSequence(Sequence &arg_sequence) :
+	words(arg_sequence.size() / PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD + 2, 0),
+	length(arg_sequence.size())
+{
+	for(size_t i = 0; i < this->length; i++)
+	{
+		unsigned int shift = (unsigned int)(62 - 2 * (i % PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD));
+		this->words[i / PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD] |= (uint64_t)(arg_sequence.data[i] & 3) << shift;
+	}
+}
+
+
+
+/**
+ * @brief Gives the number of Nucleotides in the PackedSequence
+ */
+size_t PackedSequence::size(void)
+{
+	return this->length;
+}
+
+
+
+/**
+ * @brief Unpacks a single nucleotide
+ */
+Nucleotide PackedSequence::operator[](size_t arg_position)
+{
+#if DEBUG
+	if(arg_position >= this->length)
+	{
+		throw std::invalid_argument("PackedSequence::operator[]: Out of bound PackedSequence");
+	}
+#endif //DEBUG
+	
+	unsigned int shift = (unsigned int)(62 - 2 * (arg_position % PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD));
+	return (Nucleotide)((this->words[arg_position / PACKEDSEQUENCE_NUCLEOTIDES_PER_WORD] >> shift) & 3);
+}
+
+
+
+/**
+ * @brief Unpacks a subsequence into a new Sequence; only meant for windows too long to be represented by key()
+ *
+ * @param arg_start is the (0-based offset) nucleotide in the sequence where the subsequence starts
+ * @param arg_stop is the (0-based offset) nucleotide in the sequence where the subsequence ends
+ */
+Sequence PackedSequence::subseq(size_t arg_start, size_t arg_stop)
+{
+	Sequence sequence = Sequence();
+	
+	for(size_t i = arg_start; i <= arg_stop; i++)
+	{
+		sequence.push_back((*this)[i]);
+	}
+	
+	return sequence;
+}
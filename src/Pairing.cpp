@@ -27,73 +27,16 @@
 #include "Pairing.hpp"
 
 /**
+ * @brief Lookup table of the pairing types, indexed by the 5' and the 3' Nucleotide
  */
-Pairing::Pairing(Nucleotide arg_n1, Nucleotide arg_n2)
+const PairingType Pairing::types[4][4] =
 {
-	this->init(arg_n1, arg_n2);
-}
-
-
-
-/**
- */
-void Pairing::init(Nucleotide arg_n1, Nucleotide arg_n2)
-{
-	switch(arg_n1)
-	{
-		case Nucleotide::A:
-			switch(arg_n2)
-			{
-				case Nucleotide::U:
-					this->type = PairingType::AU;
-					return void();
-				default:														// Makes the compiler happy..
-					break;
-			}
-			break;
-			
-		case Nucleotide::C:
-			switch(arg_n2)
-			{
-				case Nucleotide::G:
-					this->type = PairingType::CG;
-					return void();
-				default:														// Makes the compiler happy..
-					break;
-			}
-			break;
-			
-		case Nucleotide::G:
-			switch(arg_n2)
-			{
-				case Nucleotide::U:
-					this->type = PairingType::GU;
-					return void();
-				case Nucleotide::C:
-					this->type = PairingType::GC;
-					return void();
-				default:														// Makes the compiler happy..
-					break;
-			}
-			break;
-			
-		case Nucleotide::U:
-			switch(arg_n2)
-			{
-				case Nucleotide::A:
-					this->type = PairingType::UA;
-					return void();
-				case Nucleotide::G:
-					this->type = PairingType::UG;
-					return void();
-				default:														// Makes the compiler happy..
-					break;
-			}
-			break;
-	}
-	
-	this->type = PairingType::None;
-}
+	//    A                  C                  G                  U
+	{PairingType::None, PairingType::None, PairingType::None, PairingType::AU  },	// A
+	{PairingType::None, PairingType::None, PairingType::CG,   PairingType::None},	// C
+	{PairingType::None, PairingType::GC,   PairingType::None, PairingType::GU  },	// G
+	{PairingType::UA,   PairingType::None, PairingType::UG,   PairingType::None}	// U
+};
 
 
 
@@ -0,0 +1,85 @@
+/**
+ * @file src/PairingMatrix.cpp
+ *
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+
+#include "main.hpp"
+
+#include "Nucleotide.hpp"
+#include "Sequence.hpp"
+#include "PairingType.hpp"
+#include "Pairing.hpp"
+#include "PairingMatrix.hpp"
+
+
+
+/**
+ * @brief Classifies all pairs of the sequence once
+ */
+PairingMatrix::PairingMatrix(Sequence &arg_sequence) :
+	PairingMatrix(arg_sequence, 0)
+{
+}
+
+
+
+/**
+ * @brief Classifies all pairs (i,j) with |i - j| <= arg_max_span once
+ *
+ * @param arg_max_span Largest |i - j| that is classified; 0 for all pairs
+ */
+PairingMatrix::PairingMatrix(Sequence &arg_sequence, size_t arg_max_span) :
+	nucleotides(arg_sequence.data),
+	max_span((arg_max_span == 0 || arg_max_span > arg_sequence.size()) ? arg_sequence.size() : arg_max_span),
+	words_per_row(std::min(arg_sequence.size() / PAIRINGMATRIX_BITS_PER_WORD + 1, (2 * this->max_span) / PAIRINGMATRIX_BITS_PER_WORD + 2))
+{
+	size_t n = this->nucleotides.size();
+	this->bits = std::vector<uint64_t>(n * this->words_per_row, 0);
+	
+	for(size_t i = 0; i < n; i++)
+	{
+		for(size_t j = i + 1; j < n && j - i <= this->max_span; j++)
+		{
+			if(this->type(i, j) != PairingType::None)
+			{
+				this->bits[i * this->words_per_row + j / PAIRINGMATRIX_BITS_PER_WORD - this->first_word(i)] |= (uint64_t) 1 << (j % PAIRINGMATRIX_BITS_PER_WORD);
+				this->bits[j * this->words_per_row + i / PAIRINGMATRIX_BITS_PER_WORD - this->first_word(j)] |= (uint64_t) 1 << (i % PAIRINGMATRIX_BITS_PER_WORD);
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Gives the number of Nucleotides the matrix was built for
+ */
+size_t PairingMatrix::size(void)
+{
+	return this->nucleotides.size();
+}
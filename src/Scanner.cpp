@@ -0,0 +1,198 @@
+/**
+ * @file src/Scanner.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+
+#include "main.hpp"
+
+#include <algorithm>
+
+#include "Pair.hpp"
+#include "Region.hpp"
+#include "Nucleotide.hpp"
+#include "Pairing.hpp"
+#include "PairingPlus.hpp"
+#include "Sequence.hpp"
+
+#include "Direction.hpp"
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+
+#include "Settings.hpp"
+#include "DotBracket.hpp"
+#include "ReadData.hpp"
+#include "ScoringMatrix.hpp"
+#include "Zuker.hpp"
+
+#include "Scanner.hpp"
+
+
+
+/**
+ * @brief Constructor of the Scanner class.
+ *
+ * @param arg_settings Settings with the window size (-w) and step (-S); a maximum span (-L) smaller than the window is kept
+ * @param arg_thermodynamics Parameters (and segments)
+ * @param arg_output Stream to which the BED records are written
+ */
+Scanner::Scanner(Settings &arg_settings, ReadData &arg_thermodynamics, std::ostream &arg_output) :
+	settings(arg_settings),
+	thermodynamics(arg_thermodynamics),
+	output(arg_output),
+	window_size(arg_settings.window_size),
+	window_step(arg_settings.window_step > 0 ? arg_settings.window_step : arg_settings.window_size / 2)
+{
+	if(this->window_size < 2)
+	{
+		throw std::invalid_argument("Scanner::Scanner(): windows must be at least 2 nucleotides");
+	}
+	
+	this->max_span = this->window_size - 1;
+	if(arg_settings.maximal_pair_span > 0)
+	{
+		this->max_span = std::min(this->max_span, (size_t) arg_settings.maximal_pair_span);
+	}
+	
+	this->windows_per_chunk = 1 + (SCANNER_CHUNK_FACTOR - 1) * this->window_size / this->window_step;
+}
+
+
+
+/**
+ * @brief Scans the forward strand and then the reverse strand of a sequence
+ *
+ * @param arg_name Name of the sequence; only the part before the first space is used
+ * @param arg_sequence The sequence
+ */
+template <class Engine>
+void Scanner::scan(std::string &arg_name, Sequence &arg_sequence)
+{
+	std::string name = arg_name.substr(0, arg_name.find_first_of(" \t"));
+	if(name.empty())
+	{
+		name = "Sequence";
+	}
+	
+	this->scan_strand<Engine>(name, arg_sequence, '+');
+	
+	Sequence reverse_complement = arg_sequence.reverse_complement();
+	this->scan_strand<Engine>(name, reverse_complement, '-');
+}
+
+
+
+/**
+ * @brief Folds the windows of a single strand, chunk by chunk
+ *
+ * @param arg_name Name of the sequence
+ * @param arg_sequence The strand, from its 5' end
+ * @param arg_strand '+' or '-'; the coordinates of the '-' strand are converted to the forward strand
+ */
+template <class Engine>
+void Scanner::scan_strand(std::string &arg_name, Sequence &arg_sequence, char arg_strand)
+{
+	size_t n = arg_sequence.size();
+	size_t window_begin = 0;
+	size_t window_end = 0;
+	size_t k;
+	
+	Settings chunk_settings = this->settings;
+	chunk_settings.maximal_pair_span = (unsigned int) this->max_span;
+	
+	while(window_end < n)
+	{
+		size_t chunk_begin = window_begin;
+		size_t chunk_end = std::min(n, chunk_begin + (this->windows_per_chunk - 1) * this->window_step + this->window_size);
+		
+		Sequence chunk = arg_sequence.subseq(chunk_begin, chunk_end - 1);
+		Engine zuker = Engine(chunk_settings, chunk, this->thermodynamics);
+		zuker.energy();
+		
+		for(k = 0; k < this->windows_per_chunk && window_end < n; k++, window_begin += this->window_step)
+		{
+			window_end = std::min(n, window_begin + this->window_size);
+			
+			float energy = zuker.energy(window_begin - chunk_begin, window_end - chunk_begin);
+			unsigned int segments = 0;
+			std::string structure = std::string();
+			
+			if(!this->settings.energy_only)
+			{
+				zuker.traceback();
+				zuker.dot_bracket.format((unsigned int)(window_end - chunk_begin), structure);
+				structure.erase(0, window_begin - chunk_begin);
+				
+				segments = zuker.get_folded_segments();
+			}
+			
+			if(arg_strand == '+')
+			{
+				this->write_record(arg_name, window_begin, window_end, energy, segments, arg_strand, structure);
+			}
+			else
+			{
+				this->write_record(arg_name, n - window_end, n - window_begin, energy, segments, arg_strand, structure);
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Writes the BED record of a single window
+ *
+ * @param arg_structure The structure of the window; empty in energy only mode
+ */
+void Scanner::write_record(std::string &arg_name, size_t arg_start, size_t arg_end, float arg_energy, unsigned int arg_segments, char arg_strand, std::string &arg_structure)
+{
+	char fields[128];
+	snprintf(fields, sizeof(fields), "\t%zu\t%zu\t%.2f\t%u\t%c", arg_start, arg_end, arg_energy, arg_segments, arg_strand);
+	
+	this->output << arg_name << fields;
+	if(!this->settings.energy_only)
+	{
+		this->output << "\t" << arg_structure;
+	}
+	this->output << "\n";
+}
+
+
+
+template void Scanner::scan<ZukerEngine<FloatEnergy> >(std::string &arg_name, Sequence &arg_sequence);
+template void Scanner::scan<ZukerEngine<FloatEnergy, ZukerFeatures<true, false> > >(std::string &arg_name, Sequence &arg_sequence);
+template void Scanner::scan<ZukerEngine<FloatEnergy, ZukerFeatures<false, true> > >(std::string &arg_name, Sequence &arg_sequence);
+template void Scanner::scan<ZukerEngine<FloatEnergy, ZukerFeatures<false, false> > >(std::string &arg_name, Sequence &arg_sequence);
+
+template void Scanner::scan<ZukerEngine<FloatEnergy, ZukerFeatures<true, true, ZUKER_CONSTANT_HAIRPIN_LENGTH> > >(std::string &arg_name, Sequence &arg_sequence);
+template void Scanner::scan<ZukerEngine<FloatEnergy, ZukerFeatures<true, false, ZUKER_CONSTANT_HAIRPIN_LENGTH> > >(std::string &arg_name, Sequence &arg_sequence);
+template void Scanner::scan<ZukerEngine<FloatEnergy, ZukerFeatures<false, true, ZUKER_CONSTANT_HAIRPIN_LENGTH> > >(std::string &arg_name, Sequence &arg_sequence);
+template void Scanner::scan<ZukerEngine<FloatEnergy, ZukerFeatures<false, false, ZUKER_CONSTANT_HAIRPIN_LENGTH> > >(std::string &arg_name, Sequence &arg_sequence);
@@ -0,0 +1,305 @@
+/**
+ * @file src/Scheduler.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+#include "main.hpp"
+
+#include <algorithm>
+
+#include "Pair.hpp"
+#include "Region.hpp"
+#include "Nucleotide.hpp"
+#include "Pairing.hpp"
+#include "PairingPlus.hpp"
+#include "Sequence.hpp"
+
+#include "Direction.hpp"
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+
+#include "Settings.hpp"
+#include "DotBracket.hpp"
+#include "ReadData.hpp"
+#include "ScoringMatrix.hpp"
+#include "Zuker.hpp"
+#include "Scanner.hpp"
+
+#include "Scheduler.hpp"
+
+
+
+/**
+ * @brief Constructor of the Scheduler class.
+ *
+ * @param arg_settings Settings that provide the (remaining) records of the input
+ * @param arg_sequence The Sequence object that is set by arg_settings
+ * @param arg_thermodynamics Parameters (and segments) shared by all threads
+ */
+Scheduler::Scheduler(Settings &arg_settings, Sequence &arg_sequence, ReadData &arg_thermodynamics) :
+	settings(arg_settings),
+	sequence(arg_sequence),
+	thermodynamics(arg_thermodynamics),
+	exhausted(false),
+	chunk_size(SCHEDULER_CHUNK_SIZE)
+{
+}
+
+
+
+/**
+ * @brief Reads the next chunk of records; the current sequence of the Settings is the first of them
+ *
+ * @return Whether any record was read
+ */
+bool Scheduler::read_chunk(std::vector<scheduler_job> &jobs)
+{
+	jobs.clear();
+	
+	while(!this->exhausted && jobs.size() < this->chunk_size)
+	{
+		jobs.push_back({this->settings.sequence_name, this->sequence, std::string()});
+		this->exhausted = !this->settings.next_sequence();
+	}
+	
+	return !jobs.empty();
+}
+
+
+
+/**
+ * @brief Folds, traces back and formats a single job
+ */
+template <class Engine>
+void Scheduler::fold_job(Settings &job_settings, scheduler_job &job, ReadData &thermodynamics)
+{
+	Engine zuker = Engine(job_settings, job.sequence, thermodynamics);
+	zuker.energy();
+	if(!job_settings.energy_only)
+	{
+		zuker.traceback();
+	}
+	zuker.format_2D_structure(job.output);
+}
+
+
+
+/**
+ * @brief Scans the windows of a single job and writes their records to stdout
+ */
+template <class Engine>
+void Scheduler::scan_job(Settings &job_settings, scheduler_job &job, ReadData &thermodynamics)
+{
+	Scanner scanner = Scanner(job_settings, thermodynamics, std::cout);
+	scanner.scan<Engine>(job.name, job.sequence);
+}
+
+
+
+/**
+ * @brief Selects the engine with or without the minimal hairpin length compiled in, for folding or for scanning
+ */
+template <bool Segments, bool SegmentLoops>
+scheduler_fold_function Scheduler::select_engine(bool constant_hairpin)
+{
+	typedef ZukerEngine<FloatEnergy, ZukerFeatures<Segments, SegmentLoops, ZUKER_CONSTANT_HAIRPIN_LENGTH> > ConstantHairpinEngine;
+	typedef ZukerEngine<FloatEnergy, ZukerFeatures<Segments, SegmentLoops> > Engine;
+	
+	if(this->settings.window_size > 0)
+	{
+		return constant_hairpin ? &Scheduler::scan_job<ConstantHairpinEngine> : &Scheduler::scan_job<Engine>;
+	}
+	
+	if(constant_hairpin)
+	{
+		return &Scheduler::fold_job<ConstantHairpinEngine>;
+	}
+	
+	return &Scheduler::fold_job<Engine>;
+}
+
+
+
+/**
+ * @brief Selects the Zuker engine without the segment lookups that can not give a hit
+ *
+ * @section DESCRIPTION
+ * The SegmentTree and SegmentLoopTree are empty with -p 0 or when the
+ * segment file has none of them; the default segment file has no
+ * SegmentLoops. With the default minimal hairpin length, it is
+ * compiled into the engine as well.
+ */
+scheduler_fold_function Scheduler::select_engine(void)
+{
+	bool segments = !this->thermodynamics.segments.empty();
+	bool segmentloops = !this->thermodynamics.segmentloops.empty();
+	bool constant_hairpin = (this->settings.minimal_hairpin_length == ZUKER_CONSTANT_HAIRPIN_LENGTH);
+	
+	if(segments)
+	{
+		return segmentloops ? this->select_engine<true, true>(constant_hairpin) : this->select_engine<true, false>(constant_hairpin);
+	}
+	
+	return segmentloops ? this->select_engine<false, true>(constant_hairpin) : this->select_engine<false, false>(constant_hairpin);
+}
+
+
+
+/**
+ * @brief Folds all jobs with the selected Zuker engine and stores their formatted 2D structures in scheduler_job::output
+ */
+void Scheduler::fold(std::vector<scheduler_job> &jobs)
+{
+	this->fold(jobs, this->select_engine());
+}
+
+
+
+/**
+ * @brief Folds all jobs with the given fold function and stores their formatted 2D structures in scheduler_job::output
+ *
+ * @section DESCRIPTION
+ * GibbsFreeEnergy extends the interpolated loop tables in ReadData
+ * when it gets a sequence longer than any before. This is done once,
+ * single-threaded, for the longest sequence so that the Zuker objects
+ * in the threads only read from the ReadData object.
+ *
+ * A single job is folded outside of any parallel region: nested
+ * parallelism is disabled by default, so the parallel region in
+ * Zuker::energy() would otherwise get only one thread.
+ */
+void Scheduler::fold(std::vector<scheduler_job> &jobs, scheduler_fold_function fold_job)
+{
+	if(jobs.empty())
+	{
+		return void();
+	}
+	
+	size_t k;
+	std::vector<size_t> order = std::vector<size_t>(jobs.size());
+	for(k = 0; k < jobs.size(); k++)
+	{
+		order[k] = k;
+	}
+	
+	std::stable_sort(order.begin(), order.end(), [&jobs](size_t a, size_t b)
+	{
+		return jobs[a].sequence.size() > jobs[b].sequence.size();
+	});
+	
+	GibbsFreeEnergy(jobs[order[0]].sequence, this->thermodynamics, this->settings.maximal_pair_span);
+	
+	if(jobs.size() == 1)
+	{
+		Settings job_settings = this->settings;
+		job_settings.sequence_name = jobs[0].name;
+		
+		fold_job(job_settings, jobs[0], this->thermodynamics);
+		
+		return void();
+	}
+	
+	std::string error = std::string();
+	
+	#pragma omp parallel for num_threads(this->settings.num_threads) schedule(dynamic, 1)
+	for(k = 0; k < order.size(); k++)
+	{
+		scheduler_job &job = jobs[order[k]];
+		
+		Settings job_settings = this->settings;
+		job_settings.num_threads = 1;
+		job_settings.sequence_name = job.name;
+		
+		try
+		{
+			fold_job(job_settings, job, this->thermodynamics);
+		}
+		catch(std::invalid_argument &e)									// exceptions may not leave an OpenMP region
+		{
+			#pragma omp critical
+			error = e.what();
+		}
+	}
+	
+	if(!error.empty())
+	{
+		throw std::invalid_argument(error);
+	}
+}
+
+
+
+/**
+ * @brief Scans the windows of all jobs, one job after another
+ *
+ * @section DESCRIPTION
+ * A chunk of consecutive windows is folded with the parallelism inside
+ * Zuker::energy(), and its records are written before the next chunk
+ * is folded, so that the output of a genome is streamed.
+ */
+void Scheduler::scan(std::vector<scheduler_job> &jobs)
+{
+	scheduler_fold_function scan_job = this->select_engine();
+	
+	for(std::vector<scheduler_job>::iterator job = jobs.begin(); job != jobs.end(); ++job)
+	{
+		Settings job_settings = this->settings;
+		job_settings.sequence_name = job->name;
+		
+		scan_job(job_settings, *job, this->thermodynamics);
+	}
+}
+
+
+
+/**
+ * @brief Folds all records of the input and prints them in input order; or scans them with -w
+ */
+void Scheduler::run(void)
+{
+	std::vector<scheduler_job> jobs;
+	
+	while(this->read_chunk(jobs))
+	{
+		if(this->settings.window_size > 0)
+		{
+			this->scan(jobs);
+		}
+		else
+		{
+			this->fold(jobs);
+			
+			for(std::vector<scheduler_job>::iterator it = jobs.begin(); it != jobs.end(); ++it)
+			{
+				std::cout << it->output;
+			}
+		}
+	}
+}
@@ -74,12 +74,61 @@
  * [   ][   ][   ][ i ][ i ]
  * </PRE>
  */
-template <class T>
-ScoringMatrix<T>::ScoringMatrix(size_t arg_length, T arg_initialization_value):
-	m(this->number_of_elements(arg_length))
+template <class T, class Layout>
+ScoringMatrix<T, Layout>::ScoringMatrix(size_t arg_length, T arg_initialization_value):
+	ScoringMatrix(arg_length, arg_initialization_value, false, 0)
 {
-	this->grid_size = arg_length;///@todo double check whether grid_size shouldn't be renamed to sequence_size or 1D size
-	this->initialization_value = arg_initialization_value;
+}
+
+
+
+/**
+ * @brief Constructs the matrix with or without a column-major copy
+ *
+ * @param arg_length Size of the sequence
+ * @param arg_initialization_value Value of the positions that are not stored
+ * @param arg_transposed_copy Whether to keep the column-major copy
+ */
+template <class T, class Layout>
+ScoringMatrix<T, Layout>::ScoringMatrix(size_t arg_length, T arg_initialization_value, bool arg_transposed_copy):
+	ScoringMatrix(arg_length, arg_initialization_value, arg_transposed_copy, 0)
+{
+}
+
+
+
+/**
+ * @brief Constructs the matrix, or only a band of it, with or without a column-major copy
+ *
+ * @section DESCRIPTION
+ * Column j of the copy holds the positions (max(0, j - max_span),j)
+ * ... (j,j). The diagonal (j,j) is part of the copy and holds the
+ * initialization value, so that a bifurcation that ends on the
+ * diagonal can read it without a branch. The copy doubles the memory
+ * of the matrix.
+ *
+ * @param arg_length Size of the sequence
+ * @param arg_initialization_value Value of the positions that are not stored
+ * @param arg_transposed_copy Whether to keep the column-major copy
+ * @param arg_max_span Largest j - i that is stored; 0 for the entire triangle
+ */
+template <class T, class Layout>
+ScoringMatrix<T, Layout>::ScoringMatrix(size_t arg_length, T arg_initialization_value, bool arg_transposed_copy, size_t arg_max_span):
+	grid_size(arg_length),///@todo double check whether grid_size shouldn't be renamed to sequence_size or 1D size
+	max_span((arg_length == 0) ? 0 : ((arg_max_span == 0 || arg_max_span > arg_length - 1) ? arg_length - 1 : arg_max_span)),
+	initialization_value(arg_initialization_value),
+	m((arg_length == 0) ? 0 : Layout::size(arg_length, this->max_span)),
+	transposed_copy(arg_transposed_copy)
+{
+	if(this->transposed_copy)
+	{
+		this->m_transposed = std::vector<T>(this->column_start(arg_length));
+		
+		for(size_t j = 0; j < arg_length; j++)
+		{
+			this->column(j)[j] = arg_initialization_value;
+		}
+	}
 }
 
 
@@ -88,8 +137,8 @@ ScoringMatrix<T>::ScoringMatrix(size_t arg_length, T arg_initialization_value):
  * @brief Gets the value at matrix point [x,y]
  *
  */
-template <class T>
-T ScoringMatrix<T>::get(Pair &pair)
+template <class T, class Layout>
+T ScoringMatrix<T, Layout>::get(Pair &pair)
 {
 	signed int position = this->get_position(pair);
 	
@@ -106,8 +155,8 @@ T ScoringMatrix<T>::get(Pair &pair)
  *
  * @todo put constant in ScoringMatrix.hpp
  */
-template <class T>
-signed int ScoringMatrix<T>::get_position(Pair &p)
+template <class T, class Layout>
+signed int ScoringMatrix<T, Layout>::get_position(Pair &p)
 {
 	signed int output = 0;
 	
@@ -135,14 +184,14 @@ signed int ScoringMatrix<T>::get_position(Pair &p)
 		{
 			return -1;
 		}
+		else if(p.second > p.first + this->max_span)					// Outside the band
+		{
+			return -1;
+		}
 		else if(p.second > p.first)
 		{
-			size_t r = this->grid_size - p.first - 1;
-			size_t bottom = this->number_of_elements(r);
-			size_t row = (this->grid_size - 1) - p.second;
-			
 			///@todo change tis into size_t, and if out of bounds have to be returned, change this to MAX VALsize_t -1 and MAX VAL size_t -2
-			return (signed int) this->m.size() - (signed int) bottom - (signed int) row - 1;
+			return (signed int) Layout::position(this->grid_size, this->max_span, p.first, p.second);
 		}
 	}
 	
@@ -154,25 +203,184 @@ signed int ScoringMatrix<T>::get_position(Pair &p)
 /**
  * @brief Sets a value in the matrix
  *
+ * @section DESCRIPTION
+ * Positions that are not stored, such as the diagonals and the
+ * positions outside the band, throw an exception in DEBUG mode and are
+ * left unchanged otherwise.
+ *
  * @todo Check whether diagonals are initiated; it takes unnecessairy computations
  */
-template <class T>
-void ScoringMatrix<T>::set(Pair &pair, T arg_value)
+template <class T, class Layout>
+void ScoringMatrix<T, Layout>::set(Pair &pair, T arg_value)
 {
-#if DEBUG
 	signed int position = this->get_position(pair);
 	
-	if(position >= 0)
-	{
-		this->m[(size_t) position] = arg_value;
-	}
-	else
+	if(position < 0)
 	{
+#if DEBUG
 		throw std::invalid_argument("ScoringMatrix::set: Out of bound");
-	}
 #else //DEBUG
-	this->m[(size_t) this->get_position(pair)] = arg_value;
+		return void();
 #endif //DEBUG
+	}
+	
+	this->m[(size_t) position] = arg_value;
+	
+	if(this->transposed_copy)
+	{
+		this->column(pair.second)[pair.first] = arg_value;
+	}
+}
+
+
+
+/**
+ * @brief Returns a pointer to position (i,i+1); the positions (i,i+2) ... (i,min(n-1,i+max_span)) follow contiguously
+ *
+ * @param i Row; must be smaller than n - 1
+ */
+template <class T, class Layout>
+T *ScoringMatrix<T, Layout>::row(size_t i)
+{
+	if(!Layout::contiguous_rows)
+	{
+		throw std::invalid_argument("ScoringMatrix::row: the layout of the matrix has no contiguous rows");
+	}
+	
+	return this->m.data() + Layout::position(this->grid_size, this->max_span, i, i + 1);
+}
+
+
+
+/**
+ * @brief Copies the positions (i_begin,j) ... (i_end-1,j) of column j
+ *
+ * @section DESCRIPTION
+ * Within the vector, the distance between (i,j) and (i+1,j) is
+ * min(n - i - 1, max_span) - 1 in the row layout and -(n - j + i) in
+ * the diagonal layout, so the column is walked without calculating each
+ * position. Positions on or below the diagonal and outside the band get
+ * the initialization value.
+ *
+ * @param j Column
+ * @param i_begin First row
+ * @param i_end Row after the last row
+ * @param output Array of at least i_end - i_begin elements
+ */
+template <class T, class Layout>
+void ScoringMatrix<T, Layout>::get_column(size_t j, size_t i_begin, size_t i_end, T *output)
+{
+	size_t i = i_begin;
+	
+	for(; i + this->max_span < j && i < i_end; i++)
+	{
+		*output++ = this->initialization_value;
+	}
+	
+	if(i < j && i < i_end)
+	{
+		Pair p = Pair((unsigned int) i, (unsigned int) j);
+		size_t position = (size_t) this->get_position(p);
+		
+		for(; i < j && i < i_end; i++)
+		{
+			*output++ = this->m[position];
+			
+			if(Layout::contiguous_rows)
+			{
+				position += std::min(this->grid_size - i - 1, this->max_span) - 1;
+			}
+			else
+			{
+				position -= this->grid_size - j + i;
+			}
+		}
+	}
+	
+	for(; i < i_end; i++)
+	{
+		*output++ = this->initialization_value;
+	}
+}
+
+
+
+/**
+ * @brief Whether the matrix keeps a column-major copy
+ */
+template <class T, class Layout>
+bool ScoringMatrix<T, Layout>::has_transposed_copy(void)
+{
+	return this->transposed_copy;
+}
+
+
+
+/**
+ * @brief Returns a pointer to column j of the column-major copy, such that column(j)[i] is (i,j) for j - max_span <= i <= j
+ *
+ * @param j Column; the matrix must have a column-major copy
+ */
+template <class T, class Layout>
+T *ScoringMatrix<T, Layout>::column(size_t j)
+{
+	return this->m_transposed.data() + this->column_start(j) - ((j > this->max_span) ? j - this->max_span : 0);
+}
+
+
+
+/**
+ * @brief Number of positions in the columns before column j of the column-major copy
+ *
+ * @section DESCRIPTION
+ * Column c holds min(c, max_span) + 1 positions. Column n gives the size
+ * of the copy.
+ */
+template <class T, class Layout>
+size_t ScoringMatrix<T, Layout>::column_start(size_t j)
+{
+	size_t w = this->max_span;
+	
+	if(j <= w + 1)
+	{
+		return ((j + 1) * j) / 2;
+	}
+	
+	return ((w + 2) * (w + 1)) / 2 + (j - w - 1) * (w + 1);
+}
+
+
+
+/**
+ * @brief Returns row i as a span, in which element k is position (i,i+1+k)
+ *
+ * @param i Row; must be smaller than n - 1
+ */
+template <class T, class Layout>
+ScoringMatrixSpan<T> ScoringMatrix<T, Layout>::row_span(size_t i)
+{
+	return ScoringMatrixSpan<T> {this->row(i), 0, std::min(this->grid_size - i - 1, this->max_span)};
+}
+
+
+
+/**
+ * @brief Returns column j of the column-major copy as a span, in which element k is position (k,j) for max(0, j - max_span) <= k <= j
+ *
+ * @section DESCRIPTION
+ * The first element of the span is the first row within the band. The
+ * last element is the diagonal (j,j). It is stored as padding that
+ * holds the initialization value, so a loop that ends on the diagonal
+ * needs no branch for it.
+ *
+ * @param j Column; the matrix must have a column-major copy
+ */
+template <class T, class Layout>
+ScoringMatrixSpan<T> ScoringMatrix<T, Layout>::column_span(size_t j)
+{
+	size_t first = (j > this->max_span) ? j - this->max_span : 0;
+	
+	return ScoringMatrixSpan<T> {this->m_transposed.data() + this->column_start(j), first, j - first + 1};
 }
 
 
@@ -180,14 +388,25 @@ void ScoringMatrix<T>::set(Pair &pair, T arg_value)
 /**
  * @brief Returns the number of reserved elements in the vector
  */
-template <class T>
-size_t ScoringMatrix<T>::size(void)
+template <class T, class Layout>
+size_t ScoringMatrix<T, Layout>::size(void)
 {
 	return this->m.size();
 }
 
 
 
+/**
+ * @brief Returns the largest j - i that is stored; n - 1 if the entire triangle is stored
+ */
+template <class T, class Layout>
+size_t ScoringMatrix<T, Layout>::get_max_span(void)
+{
+	return this->max_span;
+}
+
+
+
 /**
  * @brief Calculates the number of elements in the array that correspond to the size of the grid
  *
@@ -206,8 +425,8 @@ size_t ScoringMatrix<T>::size(void)
  *
  * @note "((n - 1) * n) / 2" works, while "((n - 1) / 2) * n" does not because of floating point divisions
  */
-template <class T>
-size_t ScoringMatrix<T>::number_of_elements(size_t n)
+template <class T, class Layout>
+size_t ScoringMatrix<T, Layout>::number_of_elements(size_t n)
 {
 	return ((n - 1) * n) / 2;
 }
@@ -219,8 +438,8 @@ size_t ScoringMatrix<T>::number_of_elements(size_t n)
  *
  * @todo use m.assign()
  */
-template <class T>
-void ScoringMatrix<T>::fill(T arg_value)
+template <class T, class Layout>
+void ScoringMatrix<T, Layout>::fill(T arg_value)
 {
 	unsigned int i;
 	
@@ -228,6 +447,12 @@ void ScoringMatrix<T>::fill(T arg_value)
 	{
 		this->m[i] = arg_value;
 	}
+	
+	for(size_t j = 0; j < this->grid_size && this->transposed_copy; j++)
+	{
+		size_t i_begin = (j > this->max_span) ? j - this->max_span : 0;
+		std::fill(this->column(j) + i_begin, this->column(j) + j, arg_value);
+	}
 }
 
 
@@ -238,8 +463,14 @@ template class ScoringMatrix<SegmentTraceback *>;
 template class ScoringMatrix<char>;
 template class ScoringMatrix<Pair>;
 template class ScoringMatrix<traceback_jump>;
+template class ScoringMatrix<uint16_t>;
+template class ScoringMatrix<uint32_t>;
+
+template class ScoringMatrix<signed int, ScoringMatrixDiagonalLayout>;
+template class ScoringMatrix<float, ScoringMatrixDiagonalLayout>;
+template class ScoringMatrix<uint16_t, ScoringMatrixDiagonalLayout>;
+template class ScoringMatrix<uint32_t, ScoringMatrixDiagonalLayout>;
 
-//template class ScoringMatrix<unsigned int>;
 //template class ScoringMatrix<double>;
 //template class ScoringMatrix<short>;
 //template class ScoringMatrix<bool>; <- this one causes problems in paralel mode! do never use it.
@@ -0,0 +1,232 @@
+/**
+ * @file src/SegmentIndex.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+#include "main.hpp"
+
+#include <algorithm>
+
+#include "Pair.hpp"
+#include "Direction.hpp"
+#include "Nucleotide.hpp"
+#include "Position.hpp"
+#include "Pairing.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+#include "PackedSequence.hpp"
+
+#include "Segment.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+
+#include "SegmentIndex.hpp"
+
+
+
+/**
+ * @brief Builds the index of all segment candidates within a sequence
+ *
+ * @param arg_sequence The sequence that will be folded
+ * @param arg_segments All segments that may be folded
+ */
+SegmentIndex::SegmentIndex(Sequence &arg_sequence, SegmentTree &arg_segments) :
+	SegmentIndex(arg_sequence, arg_segments, 0)
+{
+}
+
+
+
+/**
+ * @brief Builds the index of the segment candidates (i,j) with j - i <= arg_max_span
+ *
+ * @param arg_sequence The sequence that will be folded
+ * @param arg_segments All segments that may be folded
+ * @param arg_max_span Largest j - i of a candidate; 0 for no limit
+ */
+SegmentIndex::SegmentIndex(Sequence &arg_sequence, SegmentTree &arg_segments, size_t arg_max_span) :
+	candidates(arg_sequence.size())
+{
+	std::vector<Segment *> segments;
+	arg_segments.get_segments(segments);
+	
+	PackedSequence packed_sequence = PackedSequence(arg_sequence);
+	
+	std::vector<unsigned int> occurrences_5p;
+	std::vector<unsigned int> occurrences_3p;
+	
+	for(std::vector<Segment *>::iterator segment = segments.begin(); segment != segments.end(); ++segment)
+	{
+		unsigned int size_5p = (unsigned int)(*segment)->size(Direction::FivePrime);
+		unsigned int size_3p = (unsigned int)(*segment)->size(Direction::ThreePrime);
+		
+		if(size_5p == 0 || size_3p == 0)							// loops in Zuker::v() are at least one nucleotide on each side
+		{
+			continue;
+		}
+		
+		this->find_occurrences(packed_sequence, (*segment)->sequence_5p, occurrences_5p);
+		this->find_occurrences(packed_sequence, (*segment)->sequence_3p, occurrences_3p);
+		
+		// The 5' sequence starts at i + 1 and the 3' sequence ends at j - 1
+		for(std::vector<unsigned int>::iterator a = occurrences_5p.begin(); a != occurrences_5p.end(); ++a)
+		{
+			if(*a == 0)
+			{
+				continue;
+			}
+			
+			unsigned int i = *a - 1;
+			unsigned int ip = *a + size_5p;
+			
+			for(std::vector<unsigned int>::iterator b = occurrences_3p.begin(); b != occurrences_3p.end(); ++b)
+			{
+				unsigned int jp = *b - 1;
+				unsigned int j = *b + size_3p;
+				
+				if(arg_max_span > 0 && j > i + arg_max_span)			// the occurrences are sorted, so all following are too wide as well
+				{
+					break;
+				}
+				
+				if(*b > 0 && jp > ip && j < arg_sequence.size() &&
+						Pairing(arg_sequence[i], arg_sequence[j]).is_canonical() &&
+						Pairing(arg_sequence[ip], arg_sequence[jp]).is_canonical())
+				{
+					this->candidates[i].push_back({j, Pair(ip, jp), *segment});
+				}
+			}
+		}
+	}
+	
+	for(std::vector<std::vector<segment_candidate>>::iterator it = this->candidates.begin(); it != this->candidates.end(); ++it)
+	{
+		std::sort(it->begin(), it->end(), [](const segment_candidate & a, const segment_candidate & b)
+		{
+			if(a.j != b.j)
+			{
+				return a.j < b.j;
+			}
+			else if(a.p2.first != b.p2.first)
+			{
+				return a.p2.first < b.p2.first;
+			}
+			else
+			{
+				return a.p2.second > b.p2.second;
+			}
+		});
+	}
+}
+
+
+
+/**
+ * @brief Finds all start positions of a pattern in a sequence
+ *
+ * @section DESCRIPTION
+ * Patterns that fit in a packed key are matched by comparing the key
+ * of every window, longer patterns nucleotide by nucleotide.
+ *
+ * @param arg_occurrences Vector that is replaced by the start positions, in ascending order
+ */
+void SegmentIndex::find_occurrences(PackedSequence &arg_sequence, Sequence &arg_pattern, std::vector<unsigned int> &arg_occurrences)
+{
+	arg_occurrences.clear();
+	
+	size_t n = arg_sequence.size();
+	size_t m = arg_pattern.size();
+	
+	if(m <= SUBSEQUENCE_MAX_PACKED_SIZE)
+	{
+		uint64_t key = SubSequence(arg_pattern.data.begin(), arg_pattern.data.end() - 1, m).pack();
+		
+		for(size_t a = 0; a + m <= n; a++)
+		{
+			if(arg_sequence.key(a, m) == key)
+			{
+				arg_occurrences.push_back((unsigned int) a);
+			}
+		}
+	}
+	else
+	{
+		for(size_t a = 0; a + m <= n; a++)
+		{
+			size_t b = 0;
+			while(b < m && arg_sequence[a + b] == arg_pattern.data[b])
+			{
+				b++;
+			}
+			
+			if(b == m)
+			{
+				arg_occurrences.push_back((unsigned int) a);
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Finds the candidates for pair p1, in the order in which Zuker::v() visits them
+ *
+ * @param p1 The pair (i,j) enclosing the segment
+ * @param arg_begin Set to the first candidate
+ * @param arg_end Set to the end of the candidates
+ */
+void SegmentIndex::search(Pair &p1, std::vector<segment_candidate>::iterator &arg_begin, std::vector<segment_candidate>::iterator &arg_end)
+{
+	std::vector<segment_candidate> &row = this->candidates[p1.first];
+	
+	arg_begin = std::lower_bound(row.begin(), row.end(), p1.second, [](const segment_candidate & a, unsigned int j)
+	{
+		return a.j < j;
+	});
+	arg_end = std::upper_bound(arg_begin, row.end(), p1.second, [](unsigned int j, const segment_candidate & a)
+	{
+		return j < a.j;
+	});
+}
+
+
+
+/**
+ * @brief Returns the total number of candidates
+ */
+size_t SegmentIndex::size(void)
+{
+	size_t n = 0;
+	
+	for(std::vector<std::vector<segment_candidate>>::iterator it = this->candidates.begin(); it != this->candidates.end(); ++it)
+	{
+		n += it->size();
+	}
+	
+	return n;
+}
@@ -35,6 +35,7 @@
 #include "Position.hpp"
 #include "SubSequence.hpp"
 #include "Sequence.hpp"
+#include "PackedSequence.hpp"
 
 #include "SegmentLoop.hpp"
 #include "SegmentLoopTree.hpp"
@@ -47,6 +48,9 @@
 SegmentLoopTree::SegmentLoopTree()
 {
 	this->root = nullptr;
+	
+	this->table_used = 0;
+	this->table_rehash(16);
 }
 
 
@@ -63,10 +67,72 @@ SegmentLoopTree::~SegmentLoopTree()
 
 /**
  * @brief Searches for a certain SegmentLoop given a SubSequence (2 pointers make it much quicker than a deep copy of a Sequence)
+ *
+ * @section DESCRIPTION
+ * Returns the same SegmentLoop as the tree would, but only spans of a
+ * loaded length that are too long to be packed actually walk the tree.
  */
 SegmentLoop *SegmentLoopTree::search(SubSequence &arg_subsequence)
 {
-	return this->search(arg_subsequence, this->root);
+	if(arg_subsequence.size >= this->lengths.size() || !this->lengths[arg_subsequence.size])
+	{
+		return nullptr;
+	}
+	else if(arg_subsequence.size <= SUBSEQUENCE_MAX_PACKED_SIZE)
+	{
+		return this->table_search(arg_subsequence.pack(), arg_subsequence.size);
+	}
+	else
+	{
+		return this->search(arg_subsequence, this->root);
+	}
+}
+
+
+
+/**
+ * @brief Searches for the SegmentLoop at [arg_start, arg_start + arg_size - 1] of a packed sequence
+ *
+ * @section DESCRIPTION
+ * Equivalent to searching the corresponding SubSequence, but the key of
+ * the span is taken from the packed sequence in O(1).
+ */
+SegmentLoop *SegmentLoopTree::search(PackedSequence &arg_sequence, size_t arg_start, size_t arg_size)
+{
+	if(arg_size >= this->lengths.size() || !this->lengths[arg_size])
+	{
+		return nullptr;
+	}
+	else if(arg_size <= SUBSEQUENCE_MAX_PACKED_SIZE)
+	{
+		return this->table_search(arg_sequence.key(arg_start, arg_size), arg_size);
+	}
+	else
+	{
+		Sequence sequence = arg_sequence.subseq(arg_start, arg_start + arg_size - 1);
+		SubSequence subsequence = sequence.ssubseq(0, arg_size - 1);
+		
+		return this->search(subsequence, this->root);
+	}
+}
+
+
+
+/**
+ * @brief Probes the hash table for a packed sequence
+ */
+SegmentLoop *SegmentLoopTree::table_search(uint64_t arg_key, size_t arg_size)
+{
+	size_t k;
+	for(k = SegmentLoopTree::hash(arg_key, arg_size) & this->table_mask; this->table[k].segmentloop != nullptr; k = (k + 1) & this->table_mask)
+	{
+		if(this->table[k].key == arg_key && this->table[k].size == arg_size)
+		{
+			return this->table[k].segmentloop;
+		}
+	}
+	
+	return nullptr;
 }
 
 
@@ -114,6 +180,15 @@ void SegmentLoopTree::insert(SegmentLoop &arg_segmentloop)
 	{
 		this->insert(arg_segmentloop, this->root);
 	}
+	
+	size_t size = arg_segmentloop.size();
+	if(size >= this->lengths.size())
+	{
+		this->lengths.resize(size + 1, false);
+	}
+	this->lengths[size] = true;
+	
+	this->table_insert(&arg_segmentloop);
 }
 
 
@@ -209,4 +284,96 @@ void SegmentLoopTree::clear(SegmentLoopTreeElement *arg_element)
 void SegmentLoopTree::clear(void)
 {
 	this->clear(this->root);
+	this->root = nullptr;
+	
+	this->lengths.clear();
+	
+	this->table_used = 0;
+	this->table.clear();
+	this->table_rehash(16);
+}
+
+
+
+/**
+ * @brief Mixes the packed sequence and its length into a bucket index
+ */
+size_t SegmentLoopTree::hash(uint64_t arg_key, size_t arg_size)
+{
+	uint64_t h = (arg_key * 0x9E3779B97F4A7C15ULL) ^ (uint64_t) arg_size;
+	
+	h ^= h >> 31;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 29;
+	
+	return (size_t) h;
+}
+
+
+
+/**
+ * @brief Adds a segmentloop to the hash table, if its sequence can be packed
+ *
+ * @section DESCRIPTION
+ * Like the tree, the table keeps the first of two identical sequences.
+ */
+void SegmentLoopTree::table_insert(SegmentLoop *arg_segmentloop)
+{
+	size_t size = arg_segmentloop->size();
+	
+	if(size <= SUBSEQUENCE_MAX_PACKED_SIZE)
+	{
+		Sequence *sequence = arg_segmentloop->get_sequence();
+		uint64_t key = SubSequence(sequence->data.begin(), sequence->data.end() - 1, size).pack();
+		
+		size_t k;
+		for(k = SegmentLoopTree::hash(key, size) & this->table_mask; this->table[k].segmentloop != nullptr; k = (k + 1) & this->table_mask)
+		{
+			if(this->table[k].key == key && this->table[k].size == size)
+			{
+				return;
+			}
+		}
+		
+		if((this->table_used + 1) * 2 > this->table.size())
+		{
+			this->table_rehash(this->table.size() * 2);
+			
+			for(k = SegmentLoopTree::hash(key, size) & this->table_mask; this->table[k].segmentloop != nullptr; k = (k + 1) & this->table_mask)
+			{
+			}
+		}
+		
+		this->table[k] = segmentloop_table_entry {key, size, arg_segmentloop};
+		this->table_used++;
+	}
+}
+
+
+
+/**
+ * @brief Re-distributes the table over a given number of buckets
+ *
+ * @param arg_size Number of buckets; must be a power of 2
+ */
+void SegmentLoopTree::table_rehash(size_t arg_size)
+{
+	std::vector<segmentloop_table_entry> old_table;
+	old_table.swap(this->table);
+	
+	this->table.assign(arg_size, segmentloop_table_entry {0, 0, nullptr});
+	this->table_mask = arg_size - 1;
+	
+	for(std::vector<segmentloop_table_entry>::iterator it = old_table.begin(); it != old_table.end(); ++it)
+	{
+		if(it->segmentloop != nullptr)
+		{
+			size_t k;
+			for(k = SegmentLoopTree::hash(it->key, it->size) & this->table_mask; this->table[k].segmentloop != nullptr; k = (k + 1) & this->table_mask)
+			{
+			}
+			
+			this->table[k] = *it;
+		}
+	}
 }
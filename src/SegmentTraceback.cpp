@@ -76,6 +76,35 @@ SegmentTraceback::SegmentTraceback(std::vector <Pair> arg_bonds):
 
 
 
+/**
+ * @brief Copy constructor; the copy starts at the first bond and does not share iterator state with the original
+ *
+ * @section DESCRIPTION
+ * The implicit copy would keep an iterator into the bonds of the
+ * original object. Copies are used to trace back shared segments
+ * from multiple threads simultaneously.
+ */
+SegmentTraceback::SegmentTraceback(const SegmentTraceback &arg_traceback):
+	bonds(arg_traceback.bonds)
+{
+	this->reset();
+}
+
+
+
+/**
+ * @brief Assignment operator; see the copy constructor
+ */
+SegmentTraceback &SegmentTraceback::operator=(const SegmentTraceback &arg_traceback)
+{
+	this->bonds = arg_traceback.bonds;
+	this->reset();
+	
+	return *this;
+}
+
+
+
 /**
  * @brief Resets the traceback to the first bond of the segment
  *
@@ -0,0 +1,234 @@
+/**
+ * @file src/SegmentTracebackTable.cpp
+ *
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+
+#include "SegmentTraceback.hpp"
+#include "SegmentTracebackTable.hpp"
+
+
+#define SEGMENTTRACEBACKTABLE_EMPTY_KEY UINT64_MAX
+
+
+
+/**
+ * @brief Constructs an empty table
+ */
+SegmentTracebackTable::SegmentTracebackTable(void)
+{
+#ifdef _OPENMP
+	omp_init_lock(&this->lock);
+#endif //_OPENMP
+	
+	this->clear();
+}
+
+
+
+/**
+ * @brief Copies the positions of a table; the copy gets its own lock
+ */
+SegmentTracebackTable::SegmentTracebackTable(const SegmentTracebackTable &arg_table) :
+	table(arg_table.table),
+	table_mask(arg_table.table_mask),
+	table_used(arg_table.table_used)
+{
+#ifdef _OPENMP
+	omp_init_lock(&this->lock);
+#endif //_OPENMP
+}
+
+
+
+/**
+ * @brief Destructor of the SegmentTracebackTable class.
+ */
+SegmentTracebackTable::~SegmentTracebackTable(void)
+{
+#ifdef _OPENMP
+	omp_destroy_lock(&this->lock);
+#endif //_OPENMP
+}
+
+
+
+/**
+ * @brief Copies the positions of a table; the lock is kept
+ */
+SegmentTracebackTable &SegmentTracebackTable::operator=(const SegmentTracebackTable &arg_table)
+{
+	this->table = arg_table.table;
+	this->table_mask = arg_table.table_mask;
+	this->table_used = arg_table.table_used;
+	
+	return *this;
+}
+
+
+
+/**
+ * @brief Packs (i,j) into a single key
+ */
+uint64_t SegmentTracebackTable::key(Pair &p)
+{
+	return ((uint64_t) p.first << 32) | (uint64_t) p.second;
+}
+
+
+
+/**
+ * @brief Mixes the bits of a key
+ */
+size_t SegmentTracebackTable::hash(uint64_t arg_key)
+{
+	uint64_t h = arg_key * 0x9E3779B97F4A7C15ULL;
+	
+	h ^= h >> 31;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 29;
+	
+	return (size_t) h;
+}
+
+
+
+/**
+ * @brief Returns the SegmentTraceback stored at (i,j) or nullptr if there is none
+ *
+ * @section DESCRIPTION
+ * Not guarded against concurrent calls of set().
+ */
+SegmentTraceback *SegmentTracebackTable::get(Pair &p)
+{
+	uint64_t k = SegmentTracebackTable::key(p);
+	size_t i;
+	
+	for(i = SegmentTracebackTable::hash(k) & this->table_mask; this->table[i].key != SEGMENTTRACEBACKTABLE_EMPTY_KEY; i = (i + 1) & this->table_mask)
+	{
+		if(this->table[i].key == k)
+		{
+			return this->table[i].segment_traceback;
+		}
+	}
+	
+	return nullptr;
+}
+
+
+
+/**
+ * @brief Stores a SegmentTraceback at (i,j); may be called from multiple threads
+ */
+void SegmentTracebackTable::set(Pair &p, SegmentTraceback *arg_segment_traceback)
+{
+	uint64_t k = SegmentTracebackTable::key(p);
+	
+#ifdef _OPENMP
+	omp_set_lock(&this->lock);
+	this->insert(k, arg_segment_traceback);
+	omp_unset_lock(&this->lock);
+#else //_OPENMP
+	this->insert(k, arg_segment_traceback);
+#endif //_OPENMP
+}
+
+
+
+/**
+ * @brief Inserts or overwrites a key; grows the table when it would become more than half full
+ */
+void SegmentTracebackTable::insert(uint64_t arg_key, SegmentTraceback *arg_segment_traceback)
+{
+	if((this->table_used + 1) * 2 > this->table.size())
+	{
+		this->rehash(this->table.size() * 2);
+	}
+	
+	size_t i;
+	for(i = SegmentTracebackTable::hash(arg_key) & this->table_mask; this->table[i].key != SEGMENTTRACEBACKTABLE_EMPTY_KEY; i = (i + 1) & this->table_mask)
+	{
+		if(this->table[i].key == arg_key)
+		{
+			this->table[i].segment_traceback = arg_segment_traceback;
+			return void();
+		}
+	}
+	
+	this->table[i].key = arg_key;
+	this->table[i].segment_traceback = arg_segment_traceback;
+	this->table_used++;
+}
+
+
+
+/**
+ * @brief Re-distributes the table over a given number of buckets
+ *
+ * @param arg_size Number of buckets; must be a power of 2
+ */
+void SegmentTracebackTable::rehash(size_t arg_size)
+{
+	std::vector<segment_traceback_table_entry> old_table;
+	old_table.swap(this->table);
+	
+	segment_traceback_table_entry empty_entry = {SEGMENTTRACEBACKTABLE_EMPTY_KEY, nullptr};
+	this->table.assign(arg_size, empty_entry);
+	this->table_mask = arg_size - 1;
+	this->table_used = 0;
+	
+	for(std::vector<segment_traceback_table_entry>::iterator it = old_table.begin(); it != old_table.end(); ++it)
+	{
+		if(it->key != SEGMENTTRACEBACKTABLE_EMPTY_KEY)
+		{
+			this->insert(it->key, it->segment_traceback);
+		}
+	}
+}
+
+
+
+/**
+ * @brief Returns the number of stored positions
+ */
+size_t SegmentTracebackTable::size(void)
+{
+	return this->table_used;
+}
+
+
+
+/**
+ * @brief Removes all positions
+ */
+void SegmentTracebackTable::clear(void)
+{
+	this->table.clear();
+	this->rehash(16);
+}
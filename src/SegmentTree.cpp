@@ -48,6 +48,12 @@
 SegmentTree::SegmentTree()
 {
 	this->root = nullptr;
+	
+	this->max_size_5p = 0;
+	this->max_size_3p = 0;
+	
+	this->table_used = 0;
+	this->table_rehash(16);
 }
 
 
@@ -64,10 +70,55 @@ SegmentTree::~SegmentTree()
 
 /**
  * @brief Searches a pair by using sets of iterators
+ *
+ * @section DESCRIPTION
+ * Arms longer than any inserted arm are rejected right away. Arms that
+ * fit into a packed key are looked up in the flat table, only longer
+ * arms fall back to the tree. Both return the very same Segment object.
  */
 Segment *SegmentTree::search(SubSequence &arg_segment5p, SubSequence &arg_segment3p)
 {
-	return (this->empty()) ? nullptr : this->root->search_segment(arg_segment5p, arg_segment3p);
+	if(arg_segment5p.size > this->max_size_5p || arg_segment3p.size > this->max_size_3p)
+	{
+		return nullptr;
+	}
+	else if(arg_segment5p.size <= SUBSEQUENCE_MAX_PACKED_SIZE && arg_segment3p.size <= SUBSEQUENCE_MAX_PACKED_SIZE)
+	{
+		uint64_t key_5p = arg_segment5p.pack();
+		uint64_t key_3p = arg_segment3p.pack();
+		
+		size_t k;
+		for(k = SegmentTree::hash(key_5p, key_3p, arg_segment5p.size, arg_segment3p.size) & this->table_mask; this->table[k].segment != nullptr; k = (k + 1) & this->table_mask)
+		{
+			segment_table_entry &entry = this->table[k];
+			
+			if(entry.key_5p == key_5p && entry.key_3p == key_3p && entry.size_5p == arg_segment5p.size && entry.size_3p == arg_segment3p.size)
+			{
+				return entry.segment;
+			}
+		}
+		
+		return nullptr;
+	}
+	else
+	{
+		return (this->empty()) ? nullptr : this->root->search_segment(arg_segment5p, arg_segment3p);
+	}
+}
+
+
+
+/**
+ * @brief Collects all segments in the tree
+ *
+ * @param arg_segments Vector to which the segments are appended
+ */
+void SegmentTree::get_segments(std::vector<Segment *> &arg_segments)
+{
+	if(!this->empty())
+	{
+		this->root->get_segments(arg_segments);
+	}
 }
 
 
@@ -87,6 +138,11 @@ void SegmentTree::insert(Segment &arg_segment)
 	{
 		this->root->add_segment(arg_segment);
 	}
+	
+	this->table_insert(&arg_segment);
+	
+	this->max_size_5p = std::max(this->max_size_5p, arg_segment.size(Direction::FivePrime));
+	this->max_size_3p = std::max(this->max_size_3p, arg_segment.size(Direction::ThreePrime));
 }
 
 
@@ -111,3 +167,103 @@ size_t SegmentTree::size(void)
 {
 	return this->empty() ? 0 : this->root->size();
 }
+
+
+
+/**
+ * @brief Returns the length of the longest 5' or 3' sequence of all segments in the tree
+ *
+ * @section DESCRIPTION
+ * Loops in which one of the sides is longer can not be a segment,
+ * so this bounds the segment search in Zuker::v().
+ */
+size_t SegmentTree::max_size(Direction direction)
+{
+	return (direction == Direction::FivePrime) ? this->max_size_5p : this->max_size_3p;
+}
+
+
+
+/**
+ * @brief Mixes both packed arms and their lengths into a bucket index
+ */
+size_t SegmentTree::hash(uint64_t arg_key_5p, uint64_t arg_key_3p, size_t arg_size_5p, size_t arg_size_3p)
+{
+	uint64_t h = (arg_key_5p * 0x9E3779B97F4A7C15ULL) ^ (arg_key_3p + 0x632BE59BD9B4E019ULL + ((uint64_t) arg_size_5p << 8) + (uint64_t) arg_size_3p);
+	
+	h ^= h >> 31;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 29;
+	
+	return (size_t) h;
+}
+
+
+
+/**
+ * @brief Adds a segment to the flat table, if both of its arms can be packed
+ *
+ * @section DESCRIPTION
+ * The table is kept at most half full so that probe sequences stay short.
+ */
+void SegmentTree::table_insert(Segment *arg_segment)
+{
+	size_t size_5p = arg_segment->size(Direction::FivePrime);
+	size_t size_3p = arg_segment->size(Direction::ThreePrime);
+	
+	if(size_5p <= SUBSEQUENCE_MAX_PACKED_SIZE && size_3p <= SUBSEQUENCE_MAX_PACKED_SIZE)
+	{
+		if((this->table_used + 1) * 2 > this->table.size())
+		{
+			this->table_rehash(this->table.size() * 2);
+		}
+		
+		Sequence *sequence_5p = arg_segment->get_sequence(Direction::FivePrime);
+		Sequence *sequence_3p = arg_segment->get_sequence(Direction::ThreePrime);
+		
+		segment_table_entry entry;
+		entry.key_5p = SubSequence(sequence_5p->data.begin(), sequence_5p->data.end() - 1, size_5p).pack();
+		entry.key_3p = SubSequence(sequence_3p->data.begin(), sequence_3p->data.end() - 1, size_3p).pack();
+		entry.size_5p = (unsigned char) size_5p;
+		entry.size_3p = (unsigned char) size_3p;
+		entry.segment = arg_segment;
+		
+		size_t k;
+		for(k = SegmentTree::hash(entry.key_5p, entry.key_3p, size_5p, size_3p) & this->table_mask; this->table[k].segment != nullptr; k = (k + 1) & this->table_mask)
+		{
+		}
+		
+		this->table[k] = entry;
+		this->table_used++;
+	}
+}
+
+
+
+/**
+ * @brief Re-distributes the table over a given number of buckets
+ *
+ * @param arg_size Number of buckets; must be a power of 2
+ */
+void SegmentTree::table_rehash(size_t arg_size)
+{
+	std::vector<segment_table_entry> old_table;
+	old_table.swap(this->table);
+	
+	segment_table_entry empty_entry = {0, 0, 0, 0, nullptr};
+	this->table.assign(arg_size, empty_entry);
+	this->table_mask = arg_size - 1;
+	
+	for(std::vector<segment_table_entry>::iterator it = old_table.begin(); it != old_table.end(); ++it)
+	{
+		if(it->segment != nullptr)
+		{
+			size_t k;
+			for(k = SegmentTree::hash(it->key_5p, it->key_3p, it->size_5p, it->size_3p) & this->table_mask; this->table[k].segment != nullptr; k = (k + 1) & this->table_mask)
+			{
+			}
+			
+			this->table[k] = *it;
+		}
+	}
+}
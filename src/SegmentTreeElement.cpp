@@ -398,6 +398,34 @@ Segment *SegmentTreeElement::search_segment(SubSequence &arg_sequence_5p, SubSeq
 
 
 
+/**
+ * @brief Collects recursively the segments of this element and all elements below it
+ *
+ * @param arg_segments Vector to which the segments are appended
+ */
+void SegmentTreeElement::get_segments(std::vector<Segment *> &arg_segments)
+{
+	arg_segments.push_back(&this->segment);
+	
+	SegmentTreeElement *links[] =
+	{
+		this->link_5p_size_smaller, this->link_5p_size_larger,
+		this->link_5p_segment_smaller, this->link_5p_segment_larger,
+		this->link_3p_size_smaller, this->link_3p_size_larger,
+		this->link_3p_segment_smaller, this->link_3p_segment_larger
+	};
+	
+	for(unsigned int i = 0; i < 8; i++)
+	{
+		if(links[i] != nullptr)
+		{
+			links[i]->get_segments(arg_segments);
+		}
+	}
+}
+
+
+
 /**
  * @brief Counts recursively the number of elements in the tree
  */
@@ -182,6 +182,27 @@ SubSequence Sequence::ssubseq(size_t arg_start, size_t arg_stop)
 
 
 
+/**
+ * @brief Creates the reverse complement of the sequence, i.e. the opposite strand read from its 5' end
+ *
+ * @section DESCRIPTION
+ * The Nucleotide values are ordered such that the complement of n is
+ * 3 - n: A <-> U and C <-> G.
+ */
+Sequence Sequence::reverse_complement(void)
+{
+	std::vector<Nucleotide> vec = std::vector<Nucleotide>(this->data.rbegin(), this->data.rend());
+	
+	for(std::vector<Nucleotide>::iterator it = vec.begin(); it != vec.end(); ++it)
+	{
+		*it = (Nucleotide)(Nucleotide::U - *it);
+	}
+	
+	return Sequence(vec);
+}
+
+
+
 /**
  * @brief Gives the number of Nucleotides in the Sequence
  *
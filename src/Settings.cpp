@@ -65,13 +65,23 @@
 Settings::Settings(int arg_argc, char **arg_argv, Sequence &arg_sequence) :
 	argc(arg_argc),
 	argv(arg_argv),
-	obj_sequence(arg_sequence)
+	obj_sequence(arg_sequence),
+	sequence_stream(nullptr)
 {
 	this->minimal_hairpin_length = 3;
+	this->maximal_loop_length = 0;
+	this->maximal_pair_span = 0;
+	this->window_size = 0;
+	this->window_step = 0;
 	this->segment_prediction_functionality = true;
 	this->num_threads = 0;
+	this->tile_size = 64;
+	this->energy_only = false;
+	this->traceback_recomputation = false;
 	
 	this->segment_filename = std::string();
+	this->parameter_filename = std::string();
+	this->sequence_name = std::string();
 	
 	this->proceed_with_folding = true;
 	
@@ -93,15 +103,37 @@ void Settings::print_usage(bool as_error)
 	stream << "       " PACKAGE_NAME " -f [FASTA_FILE]\n";
 	stream << "   * Note: If FASTA_FILE and SEQUENCE are not provided,\n";
 	stream << "           the program will read from STDIN.\n";
+	stream << "   * Note: All records of a multi-FASTA FASTA_FILE (or STDIN)\n";
+	stream << "           are folded in parallel and reported in input order.\n";
 	stream << "\n\n";
 	stream << "The following parameters can be used:\n";
 	stream << "  -s SEQUENCE       Specific RNA SEQUENCE (overrules -f)\n";
 	stream << "  -f FASTA_FILE     Path of FASTA_FILE containing sequence(s)\n";
 	stream << "  -p                Enable/disable segment functionality           [1/0]\n";
 	stream << "  -H HAIRPINSIZE    Minimum hairpin size, default: 3               [1,N}\n";
+	stream << "  -l MAXLOOP        Maximum number of unpaired nucleotides in      [0,N}\n";
+	stream << "                    bulge and interior loops; 0 = unlimited,\n";
+	stream << "                    default: 0 (segments are not limited)\n";
+	stream << "  -L MAXSPAN        Maximum distance j - i between paired          [0,N}\n";
+	stream << "                    nucleotides; only stores the band of the\n";
+	stream << "                    matrices, 0 = unlimited, default: 0\n";
+	stream << "  -w WINDOW         Scan both strands in windows of WINDOW       0,[2,N}\n";
+	stream << "                    nucleotides and report a BED record per\n";
+	stream << "                    window; 0 = fold the entire sequences,\n";
+	stream << "                    default: 0\n";
+	stream << "  -S STEP           Distance between the windows of -w;            [0,N}\n";
+	stream << "                    0 = half the window, default: 0; requires -w\n";
 	stream << "  -x SEGMENTS_XML   Use custom  \"segments.xml\"-syntaxed file\n";
+	stream << "  -P PARAMETERS     Use a binary energy parameter file instead of\n";
+	stream << "                    the compiled parameters\n";
 	stream << "  -t NUM_THREADS    Number of threads; 0 = maximum available,      [0,N}\n";
-	stream << "                    default: 3 \n\n";
+	stream << "                    default: 3 \n";
+	stream << "  -B TILE_SIZE      Width of the tiles in which the matrices are   [1,N}\n";
+	stream << "                    filled in parallel, default: 64\n";
+	stream << "  -e                Only report the minimum free energy; skips the\n";
+	stream << "                    traceback and its matrices\n";
+	stream << "  -r                Trace back by recomputing the optimal decompositions\n";
+	stream << "                    instead of storing them in traceback matrices\n\n";
 	stream << "  -h, --help        Display this help and exit\n";
 	stream << "  -V, --version     Show version and license\n";
 	stream << "  -X, --default-xml Show path to default \"segments.xml\" on\n";
@@ -188,7 +220,7 @@ void Settings::parse_arguments(void)
 	}
 	
 	// 'So to distinguish them, getopt provides a mechanism. All the options that require argument will be preceded by a : (colon).'
-	while((c = getopt(this->argc, this->argv, "+H:f:s:p:x:t:hVX")) > 0 && proceed_parsing_arguments)
+	while((c = getopt(this->argc, this->argv, "+H:l:L:w:S:f:s:p:x:P:t:B:erhVX")) > 0 && proceed_parsing_arguments)
 	{
 		switch(c)
 		{
@@ -212,22 +244,106 @@ void Settings::parse_arguments(void)
 					sscanf(optarg, "%d", &this->minimal_hairpin_length);	// TODO use atoi?
 				}
 				break;
-			case 'f':
-				FILE *stream;
-				stream = fopen(optarg, "r");
+			case 'l':							// option -l for maximum bulge and interior loop length
+				for(i = 0; i < strlen(optarg); i++)
+				{
+					if(!isdigit(optarg[i]))
+					{
+						proceed_parsing_arguments = false;
+						break;
+					}
+				}
 				
-				if(stream != nullptr)
+				if(proceed_parsing_arguments == false)
 				{
-					this->parse_sequence_from_stream(stream);
-					fclose(stream);
+					this->print_usage(true);
+					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): " + std::string(optarg));
 				}
 				else
+				{
+					sscanf(optarg, "%u", &this->maximal_loop_length);
+				}
+				break;
+			case 'L':							// option -L for maximum base pair span
+				for(i = 0; i < strlen(optarg); i++)
+				{
+					if(!isdigit(optarg[i]))
+					{
+						proceed_parsing_arguments = false;
+						break;
+					}
+				}
+				
+				if(proceed_parsing_arguments == false)
 				{
 					this->print_usage(true);
-					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): can't open file \"" + std::string(optarg) + "\"");
+					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): " + std::string(optarg));
+				}
+				else
+				{
+					sscanf(optarg, "%u", &this->maximal_pair_span);
+				}
+				break;
+			case 'w':							// option -w for the size of the scanning windows
+				for(i = 0; i < strlen(optarg); i++)
+				{
+					if(!isdigit(optarg[i]))
+					{
+						proceed_parsing_arguments = false;
+						break;
+					}
+				}
+				
+				if(proceed_parsing_arguments == false || atoi(optarg) == 1)	// a window must hold a pair
+				{
+					this->print_usage(true);
+					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): " + std::string(optarg));
+				}
+				else
+				{
+					sscanf(optarg, "%u", &this->window_size);
+				}
+				break;
+			case 'S':							// option -S for the distance between the scanning windows
+				for(i = 0; i < strlen(optarg); i++)
+				{
+					if(!isdigit(optarg[i]))
+					{
+						proceed_parsing_arguments = false;
+						break;
+					}
+				}
+				
+				if(proceed_parsing_arguments == false)
+				{
+					this->print_usage(true);
+					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): " + std::string(optarg));
+				}
+				else
+				{
+					sscanf(optarg, "%u", &this->window_step);
+				}
+				break;
+			case 'f':
+				if(this->obj_sequence.empty())						// -s overrules -f
+				{
+					this->close_sequence_stream();
+					this->sequence_stream = fopen(optarg, "r");
+					
+					if(this->sequence_stream != nullptr)
+					{
+						this->parse_sequence_from_stream(this->sequence_stream);
+					}
+					else
+					{
+						this->print_usage(true);
+						throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): can't open file \"" + std::string(optarg) + "\"");
+					}
 				}
 				break;
 			case 's':
+				this->close_sequence_stream();
+				this->sequence_name.clear();
 				this->obj_sequence = Sequence(optarg);
 				break;
 			case 'p':
@@ -244,6 +360,17 @@ void Settings::parse_arguments(void)
 					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): can't open file \"" + std::string(optarg) + "\"");
 				}
 				break;
+			case 'P':
+				if(file_exists(optarg))
+				{
+					this->parameter_filename = std::string(optarg);
+				}
+				else
+				{
+					this->print_usage(true);
+					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): can't open file \"" + std::string(optarg) + "\"");
+				}
+				break;
 			case 't':
 				for(i = 0; i < strlen(optarg); i++)
 				{
@@ -264,6 +391,32 @@ void Settings::parse_arguments(void)
 					sscanf(optarg, "%d", &this->num_threads);
 				}
 				break;
+			case 'B':
+				for(i = 0; i < strlen(optarg); i++)
+				{
+					if(!isdigit(optarg[i]))
+					{
+						proceed_parsing_arguments = false;
+						break;
+					}
+				}
+				
+				if(proceed_parsing_arguments == false || atoi(optarg) < 1)
+				{
+					this->print_usage(true);
+					throw std::invalid_argument("Invalid argument (-" + std::string(1, (char) c) + "): " + std::string(optarg));
+				}
+				else
+				{
+					sscanf(optarg, "%u", &this->tile_size);
+				}
+				break;
+			case 'e':
+				this->energy_only = true;
+				break;
+			case 'r':
+				this->traceback_recomputation = true;
+				break;
 			case 'V':
 				proceed_parsing_arguments = false;
 				this->print_version();
@@ -279,6 +432,12 @@ void Settings::parse_arguments(void)
 		}
 	}
 	
+	if(this->proceed_with_folding && this->window_step > 0 && this->window_size == 0)
+	{
+		this->print_usage(true);
+		throw std::invalid_argument("Invalid argument (-S): only applies to scanning windows (-w)");
+	}
+	
 	if(this->proceed_with_folding)
 	{
 		this->get_segments_file();
@@ -286,21 +445,33 @@ void Settings::parse_arguments(void)
 		if(this->obj_sequence.empty())
 		{
 			printf("Please insert your RNA sequence:\n");
-			this->parse_sequence_from_stream(stdin);
+			this->sequence_stream = stdin;
+			this->parse_sequence_from_stream(this->sequence_stream);
 		}
 	}
+	else
+	{
+		this->close_sequence_stream();
+	}
 }
 
 
 
 /**
- * @brief Parses the first FASTA line from a filestream (or stdin)
+ * @brief Parses the next FASTA record from a filestream (or stdin)
+ *
+ * @section DESCRIPTION
+ * Reading stops right before the header of the next record, so that
+ * subsequent calls continue with the following record. Records without
+ * any nucleotides are skipped.
  *
  * @param stream A stream for reading, like a file handle or stdin.
  *
+ * @return Whether a non-empty sequence was obtained
+ *
  * @todo find a MAXLEN - probably related to max size of int
  */
-void Settings::parse_sequence_from_stream(FILE *stream)
+bool Settings::parse_sequence_from_stream(FILE *stream)
 {
 	int buffer;
 	
@@ -310,14 +481,19 @@ void Settings::parse_sequence_from_stream(FILE *stream)
 		{
 			if(this->obj_sequence.empty())
 			{
-				do
+				this->sequence_name.clear();
+				
+				while((buffer = fgetc(stream)) != '\n' && buffer != EOF)
 				{
-					buffer = fgetc(stream);
+					if(buffer != '\r')
+					{
+						this->sequence_name.push_back((char) buffer);
+					}
 				}
-				while(buffer != '\n');
 			}
 			else
 			{
+				ungetc(buffer, stream);									// leave the header for the next record
 				break;
 			}
 		}
@@ -330,6 +506,53 @@ void Settings::parse_sequence_from_stream(FILE *stream)
 			}
 		}
 	}
+	
+	return !this->obj_sequence.empty();
+}
+
+
+
+/**
+ * @brief Closes the FASTA input stream, unless it is stdin.
+ */
+void Settings::close_sequence_stream(void)
+{
+	if(this->sequence_stream != nullptr && this->sequence_stream != stdin)
+	{
+		fclose(this->sequence_stream);
+	}
+	
+	this->sequence_stream = nullptr;
+}
+
+
+
+/**
+ * @brief Replaces the sequence with the next record of the FASTA input (multi-FASTA batch mode).
+ *
+ * @section DESCRIPTION
+ * The thermodynamic parameters and segments are independent of the
+ * sequence, so they can be loaded once and re-used for every record.
+ *
+ * @return false if there are no more records; the sequence is then empty
+ */
+bool Settings::next_sequence(void)
+{
+	this->obj_sequence = Sequence();
+	
+	if(this->sequence_stream != nullptr)
+	{
+		if(this->parse_sequence_from_stream(this->sequence_stream))
+		{
+			return true;
+		}
+		
+		this->close_sequence_stream();
+	}
+	
+	this->sequence_name.clear();
+	
+	return false;
 }
 
 
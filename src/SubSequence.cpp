@@ -92,6 +92,36 @@ Nucleotide SubSequence::operator[](size_t arg_position)
 
 
 
+/**
+ * @brief Packs the nucleotides into a 64-bit key, 2 bits per nucleotide
+ *
+ * @section DESCRIPTION
+ * Together with the size, the key uniquely identifies the nucleotide
+ * content, which allows hash based lookups of segments and segmentloops.
+ * Only valid for subsequences of at most SUBSEQUENCE_MAX_PACKED_SIZE
+ * nucleotides.
+ */
+uint64_t SubSequence::pack(void)
+{
+#if DEBUG
+	if(this->size > SUBSEQUENCE_MAX_PACKED_SIZE)
+	{
+		throw std::invalid_argument("SubSequence::pack: SubSequence too long to be packed");
+	}
+#endif //DEBUG
+	
+	uint64_t key = 0;
+	
+	for(size_t i = 0; i < this->size; i++)
+	{
+		key = (key << 2) | (uint64_t)(*(this->position1 + (long) i) & 3);
+	}
+	
+	return key;
+}
+
+
+
 #if DEBUG
 /**
  * @brief checks whether the order of the position is correct and throws an exception otherwise
@@ -0,0 +1,229 @@
+/**
+ * @file src/TracebackMatrix.cpp
+ *
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+
+#include "ScoringMatrix.hpp"
+#include "ZukerTraceback.hpp"
+#include "TracebackMatrix.hpp"
+
+
+
+/**
+ * @brief Constructs the matrix; jumps within it go to arg_matrix and bifurcations to arg_bifurcation_matrix
+ *
+ * @param arg_length Size of the sequence
+ * @param arg_matrix V_MATRIX, W_MATRIX or WM_MATRIX
+ * @param arg_bifurcation_matrix Matrix in which both halves of a bifurcation continue
+ */
+TracebackMatrix::TracebackMatrix(size_t arg_length, char arg_matrix, char arg_bifurcation_matrix) :
+	TracebackMatrix(arg_length, arg_matrix, arg_bifurcation_matrix, 0)
+{
+}
+
+
+
+/**
+ * @brief Constructs the matrix, or only the band of pairs (i,j) with j - i <= arg_max_span
+ *
+ * @param arg_length Size of the sequence
+ * @param arg_matrix V_MATRIX, W_MATRIX or WM_MATRIX
+ * @param arg_bifurcation_matrix Matrix in which both halves of a bifurcation continue
+ * @param arg_max_span Largest j - i that is stored; 0 for the entire triangle
+ */
+TracebackMatrix::TracebackMatrix(size_t arg_length, char arg_matrix, char arg_bifurcation_matrix, size_t arg_max_span) :
+	matrix(arg_matrix),
+	bifurcation_matrix(arg_bifurcation_matrix),
+	wide(TracebackMatrix::is_wide((arg_max_span > 0 && arg_max_span < arg_length) ? arg_max_span + 1 : arg_length)),
+	narrow_m(this->wide ? 0 : arg_length, TRACEBACKMATRIX_END, false, arg_max_span),
+	wide_m(this->wide ? arg_length : 0, TRACEBACKMATRIX_END, false, arg_max_span)
+{
+}
+
+
+
+/**
+ * @brief Whether the spans within a sequence of the given length need 32 bit elements
+ *
+ * @param arg_length Size of the sequence, or of the largest span plus one
+ */
+bool TracebackMatrix::is_wide(size_t arg_length)
+{
+	if(arg_length > TRACEBACKMATRIX_WIDE_MAX_SIZE)
+	{
+		throw std::invalid_argument("TracebackMatrix::TracebackMatrix(): sequences can not be longer than " + std::to_string(TRACEBACKMATRIX_WIDE_MAX_SIZE) + " nucleotides");
+	}
+	
+	return arg_length > TRACEBACKMATRIX_NARROW_MAX_SIZE;
+}
+
+
+
+/**
+ * @brief Encodes a jump from p relative to p
+ */
+uint32_t TracebackMatrix::encode(Pair &p, traceback_jump &arg_jump)
+{
+	unsigned int span = p.second - p.first;
+	
+	if(arg_jump.target.first == (unsigned int) NOT_YET_CALCULATED)
+	{
+		return this->wide ? UINT32_MAX : UINT16_MAX;
+	}
+	else if(arg_jump.target.first == (unsigned int) UNBOUND)
+	{
+		return TRACEBACKMATRIX_END;
+	}
+	else if(arg_jump.target_matrix == V_MATRIX && arg_jump.target == p)
+	{
+		return TRACEBACKMATRIX_V_SELF;
+	}
+	else if(arg_jump.target.first == arg_jump.target.second)
+	{
+#if DEBUG
+		if(arg_jump.target_matrix != this->bifurcation_matrix || arg_jump.target.first <= p.first || arg_jump.target.first >= p.second)
+		{
+			throw std::invalid_argument("TracebackMatrix::set(" + std::to_string(p.first) + ", " + std::to_string(p.second) + "): invalid bifurcation");
+		}
+#endif //DEBUG
+		return TRACEBACKMATRIX_OFFSET + (arg_jump.target.first - p.first);
+	}
+	else
+	{
+#if DEBUG
+		if(arg_jump.target_matrix != this->matrix || arg_jump.target.first < p.first || arg_jump.target.second > p.second)
+		{
+			throw std::invalid_argument("TracebackMatrix::set(" + std::to_string(p.first) + ", " + std::to_string(p.second) + "): invalid jump");
+		}
+#endif //DEBUG
+		return TRACEBACKMATRIX_OFFSET + span + (arg_jump.target.first - p.first) * (span + 1) + (p.second - arg_jump.target.second);
+	}
+}
+
+
+
+/**
+ * @brief Decodes a value stored at p back into a traceback_jump
+ */
+traceback_jump TracebackMatrix::decode(Pair &p, uint32_t value)
+{
+	unsigned int span = p.second - p.first;
+	
+	if(value == (this->wide ? UINT32_MAX : UINT16_MAX))
+	{
+		return {{NOT_YET_CALCULATED, NOT_YET_CALCULATED}, this->matrix};
+	}
+	else if(value == TRACEBACKMATRIX_END)
+	{
+		return {{UNBOUND, UNBOUND}, this->matrix};
+	}
+	else if(value == TRACEBACKMATRIX_V_SELF)
+	{
+		return {p, V_MATRIX};
+	}
+	
+	value -= TRACEBACKMATRIX_OFFSET;
+	if(value < span)
+	{
+		return {{p.first + value, p.first + value}, this->bifurcation_matrix};
+	}
+	
+	value -= span;
+	return {{p.first + value / (span + 1), p.second - value % (span + 1)}, this->matrix};
+}
+
+
+
+/**
+ * @brief Gets the jump stored at matrix point p
+ */
+traceback_jump TracebackMatrix::get(Pair &p)
+{
+	return this->decode(p, this->wide ? this->wide_m.get(p) : this->narrow_m.get(p));
+}
+
+
+
+/**
+ * @brief Stores a jump at matrix point p
+ */
+void TracebackMatrix::set(Pair &p, traceback_jump arg_jump)
+{
+	uint32_t value = this->encode(p, arg_jump);
+	
+	if(this->wide)
+	{
+		this->wide_m.set(p, value);
+	}
+	else
+	{
+		this->narrow_m.set(p, (uint16_t) value);
+	}
+}
+
+
+
+/**
+ * @brief Fills the entire matrix with one jump; only NOT_YET_CALCULATED and UNBOUND are position independent
+ */
+void TracebackMatrix::fill(traceback_jump arg_jump)
+{
+	Pair p = Pair(0, 1);
+	uint32_t value = this->encode(p, arg_jump);
+	
+	if(this->wide)
+	{
+		this->wide_m.fill(value);
+	}
+	else
+	{
+		this->narrow_m.fill((uint16_t) value);
+	}
+}
+
+
+
+/**
+ * @brief Returns the number of reserved elements
+ */
+size_t TracebackMatrix::size(void)
+{
+	return this->wide ? this->wide_m.size() : this->narrow_m.size();
+}
+
+
+
+/**
+ * @brief Returns the number of bytes used per element: 2 or 4
+ */
+size_t TracebackMatrix::bytes_per_element(void)
+{
+	return this->wide ? sizeof(uint32_t) : sizeof(uint16_t);
+}
@@ -0,0 +1,198 @@
+/**
+ * @file src/Utils/generate_readdata_tables.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section DESCRIPTION
+ * Writes the thermodynamic parameters of the ReadData::load_*()
+ * functions as constexpr tables to stdout. Run 'make tables' to
+ * regenerate include/ReadDataTables.hpp after changing any of the
+ * parameters in src/ReadDataLoader.cpp.
+ *
+ * If a filename is given, the parameters are written to that file as
+ * binary parameter file instead, which can be used by
+ * 'segmentation-fold -P FILE'.
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "Direction.hpp"
+#include "Nucleotide.hpp"
+#include "Position.hpp"
+#include "PairingPlus.hpp"
+
+#include "Sequence.hpp"
+
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+#include "ReadData.hpp"
+
+
+
+/**
+ * @brief Formats a float as the shortest literal that is parsed back into exactly the same value
+ */
+std::string format_float(float value)
+{
+	char buffer[32];
+	
+	for(int precision = 6; precision <= 9; precision++)
+	{
+		snprintf(buffer, sizeof(buffer), "%.*g", precision, (double) value);
+		
+		if(strtof(buffer, nullptr) == value)
+		{
+			break;
+		}
+	}
+	
+	std::string literal = buffer;
+	if(literal.find_first_of(".e") == std::string::npos)
+	{
+		literal += ".0";
+	}
+	
+	return literal + "f";
+}
+
+
+
+/**
+ * @brief Prints a (multi-dimensional) array as flat initializer list
+ */
+void print_table(const char *name, std::string dimensions, const float *values, size_t size)
+{
+	printf("constexpr float %s%s =\n{\n", name, dimensions.c_str());
+	
+	for(size_t k = 0; k < size; k++)
+	{
+		printf("%s%s,%s", (k % 8 == 0) ? "\t" : "", format_float(values[k]).c_str(), (k % 8 == 7 || k == size - 1) ? "\n" : " ");
+	}
+	
+	printf("};\n\n\n\n");
+}
+
+
+
+/**
+ * @brief Prints a std::vector as array
+ */
+void print_table(const char *name, std::vector<float> &values)
+{
+	print_table(name, "[" + std::to_string(values.size()) + "]", values.data(), values.size());
+}
+
+
+
+/**
+ * @brief Prints a map of hairpin loops as list of readdata_loop, terminated by {nullptr, 0.0f}
+ */
+void print_loops(const char *name, std::map<Sequence, float> &loops)
+{
+	printf("constexpr readdata_loop %s[] =\n{\n", name);
+	
+	for(std::map<Sequence, float>::iterator it = loops.begin(); it != loops.end(); ++it)
+	{
+		Sequence sequence = it->first;
+		printf("\t{\"%s\", %s},\n", sequence.str().c_str(), format_float(it->second).c_str());
+	}
+	
+	printf("\t{nullptr, 0.0f}\n};\n\n\n\n");
+}
+
+
+
+int main(int argc, char *argv[])
+{
+	ReadData thermodynamics = ReadData();
+	thermodynamics.load();
+	
+	if(argc > 1)
+	{
+		thermodynamics.save(std::string(argv[1]));
+		return EXIT_SUCCESS;
+	}
+	
+	printf("/**\n"
+		   " * @file include/ReadDataTables.hpp\n"
+		   " *\n"
+		   " * @author Youri Hoogstrate\n"
+		   " *\n"
+		   " * @section DESCRIPTION\n"
+		   " * Thermodynamic parameters as compiled tables, copied by ReadData::ReadData().\n"
+		   " *\n"
+		   " * This file is generated by 'make tables' from the ReadData::load_*()\n"
+		   " * functions in src/ReadDataLoader.cpp - do not edit it by hand.\n"
+		   " *\n"
+		   " * @section LICENSE\n"
+		   " * segmentation-fold can predict RNA 2D structures including K-turns.\n"
+		   " * Copyright (C) 2012-2016 Youri Hoogstrate\n"
+		   " *\n"
+		   " * This file is part of segmentation-fold.\n"
+		   " *\n"
+		   " * segmentation-fold is free software: you can redistribute it and/or modify\n"
+		   " * it under the terms of the GNU General Public License as published by\n"
+		   " * the Free Software Foundation, either version 3 of the License, or\n"
+		   " * (at your option) any later version.\n"
+		   " *\n"
+		   " * segmentation-fold is distributed in the hope that it will be useful,\n"
+		   " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+		   " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the\n"
+		   " * GNU General Public License for more details.\n"
+		   " *\n"
+		   " * You should have received a copy of the GNU General Public License\n"
+		   " * along with this program. If not, see <http://www.gnu.org/licenses/>.\n"
+		   " */\n"
+		   "\n\n\n"
+		   "#ifndef READDATATABLES_HPP\n"
+		   "#define\tREADDATATABLES_HPP\n"
+		   "\n\n\n");
+		   
+	print_table("READDATA_INT11", "[6][6][4][4]", &thermodynamics.int11[0][0][0][0], sizeof(thermodynamics.int11) / sizeof(float));
+	print_table("READDATA_INT21", "[6][6][4][4][4]", &thermodynamics.int21[0][0][0][0][0], sizeof(thermodynamics.int21) / sizeof(float));
+	print_table("READDATA_INT22", "[6][6][4][4][4][4]", &thermodynamics.int22[0][0][0][0][0][0], sizeof(thermodynamics.int22) / sizeof(float));
+	
+	print_table("READDATA_STACK", "[6][6]", &thermodynamics.stack[0][0], sizeof(thermodynamics.stack) / sizeof(float));
+	print_table("READDATA_TSTACKH", "[6][4][4]", &thermodynamics.tstackh[0][0][0], sizeof(thermodynamics.tstackh) / sizeof(float));
+	print_table("READDATA_TSTACKI", "[6][4][4]", &thermodynamics.tstki[0][0][0], sizeof(thermodynamics.tstki) / sizeof(float));
+	
+	print_table("READDATA_MISCLOOP", "[20]", thermodynamics.miscloop, sizeof(thermodynamics.miscloop) / sizeof(float));
+	
+	print_table("READDATA_LOOP_HAIRPIN", thermodynamics.loop_hairpin);
+	print_table("READDATA_LOOP_BULGE", thermodynamics.loop_bulge);
+	print_table("READDATA_LOOP_INTERIOR", thermodynamics.loop_interior);
+	print_table("READDATA_POPPEN", thermodynamics.poppen_p);
+	
+	print_loops("READDATA_TLOOP", thermodynamics.tloop_map);
+	print_loops("READDATA_TRILOOP", thermodynamics.triloop_map);
+	
+	printf("constexpr unsigned int READDATA_MINIMAL_HAIRPIN_LENGTH = %u;\n", thermodynamics.minimal_hairpin_length);
+	printf("\n\n\n#endif\t// READDATATABLES_HPP\n");
+	
+	return EXIT_SUCCESS;
+}
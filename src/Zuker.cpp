@@ -34,6 +34,8 @@
 #include "PairingPlus.hpp"
 #include "SubSequence.hpp"
 #include "Sequence.hpp"
+#include "PackedSequence.hpp"
+#include "PairingMatrix.hpp"
 
 #include "Direction.hpp"
 #include "Segment.hpp"
@@ -43,6 +45,7 @@
 #include "SegmentLoopTree.hpp"
 
 #include "ScoringMatrix.hpp"
+#include "MinPlus.hpp"
 #include "Settings.hpp"
 #include "DotBracket.hpp"
 #include "ReadData.hpp"
@@ -56,27 +59,98 @@
  *
  * @todo move this to this->init(); and run this->init(); or rename it to this->reset();
  */
-Zuker::Zuker(Settings &arg_settings, Sequence &arg_sequence, ReadData &arg_thermodynamics) :
-	GibbsFreeEnergy(arg_sequence, arg_thermodynamics),
+template <class Energy, class Features>
+ZukerEngine<Energy, Features>::ZukerEngine(Settings &arg_settings, Sequence &arg_sequence, ReadData &arg_thermodynamics) :
+	GibbsFreeEnergy(arg_sequence, arg_thermodynamics, ZukerEngine<Energy, Features>::pair_span(arg_settings, arg_sequence)),
 	settings(arg_settings),
+	store_traceback(!arg_settings.energy_only && !arg_settings.traceback_recomputation),
+	max_span(ZukerEngine<Energy, Features>::pair_span(arg_settings, arg_sequence)),
 	
-	vij(arg_sequence.size(), N_INFINITY),
-	wij(arg_sequence.size(), 0.0),
-	wmij(arg_sequence.size(), N_INFINITY),
+	vij(arg_sequence.size(), Energy::infinity(), false, this->max_span),
+	wij(this->max_span == 0 ? arg_sequence.size() : 0, 0, true),
+	wmij(arg_sequence.size(), Energy::infinity(), true, this->max_span),
 	
-	tij_v(arg_sequence.size(), {Pair(UNBOUND, UNBOUND), V_MATRIX}),				//@todo use N instead of 0? >> if so, set UNBOUND to N  + 1 or so
-	  tij_w(arg_sequence.size(), {Pair(UNBOUND, UNBOUND), W_MATRIX}),				//@todo use N instead of 0? >> if so, set UNBOUND to N  + 1 or so
-	  tij_wm(arg_sequence.size(), {Pair(UNBOUND, UNBOUND), WM_MATRIX}),			//@todo use N instead of 0? >> if so, set UNBOUND to N  + 1 or so
+	hairpin_elements(arg_sequence.size(), Energy::infinity(), false, this->max_span),
+	stacking_elements(arg_sequence.size(), Energy::infinity(), false, this->max_span),
+	
+	// In energy only mode and with traceback by recomputation the traceback matrices stay empty
+	tij_v(this->store_traceback ? arg_sequence.size() : 0, V_MATRIX, WM_MATRIX, this->max_span),
+	  tij_w((this->store_traceback && this->max_span == 0) ? arg_sequence.size() : 0, W_MATRIX, W_MATRIX),
+	  tij_wm(this->store_traceback ? arg_sequence.size() : 0, WM_MATRIX, WM_MATRIX, this->max_span),
 	  
-	  sij(arg_sequence.size(), nullptr)
+	  segment_index(arg_sequence, arg_thermodynamics.segments, this->max_span)
 {
+	if((!Features::segments && !arg_thermodynamics.segments.empty()) || (!Features::segmentloops && !arg_thermodynamics.segmentloops.empty()))
+	{
+		throw std::invalid_argument("Zuker::Zuker(): segments were loaded but this engine does not predict them");
+	}
+	
 #if DEBUG
-	this->tij_v.fill({{NOT_YET_CALCULATED, NOT_YET_CALCULATED}, V_MATRIX});
-	this->tij_w.fill({{NOT_YET_CALCULATED, NOT_YET_CALCULATED}, W_MATRIX});
+	if(this->store_traceback)
+	{
+		this->tij_v.fill({{NOT_YET_CALCULATED, NOT_YET_CALCULATED}, V_MATRIX});
+		if(this->max_span == 0)
+		{
+			this->tij_w.fill({{NOT_YET_CALCULATED, NOT_YET_CALCULATED}, W_MATRIX});
+		}
+	}
 #endif //DEBUG
 	
 	this->sequence_begin = this->sequence.data.begin();
+	this->structure_begin = 0;
+	this->structure_end = arg_sequence.size();
 	this->traceback_stacktop = -1;
+	
+	this->fill_elements();
+}
+
+
+
+/**
+ * @brief The maximum base pair span of the settings, or 0 if it does not limit the pairs of the sequence
+ */
+template <class Energy, class Features>
+size_t ZukerEngine<Energy, Features>::pair_span(Settings &arg_settings, Sequence &arg_sequence)
+{
+	size_t span = arg_settings.maximal_pair_span;
+	
+	return (span + 1 < arg_sequence.size()) ? span : 0;
+}
+
+
+
+/**
+ * @brief Fills the hairpin and stacking elements of all pairs, one row at a time
+ *
+ * @section DESCRIPTION
+ * Zuker::v() reads these elements once per pair, which is then a
+ * single load instead of looking up the nucleotides and building
+ * Pairing objects. The rows are converted with Energy::from_kcal().
+ */
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::fill_elements(void)
+{
+	size_t n = this->sequence.size();
+	std::vector<float> elements = std::vector<float>(n);
+	
+	for(size_t i = 0; i + 1 < n; i++)
+	{
+		size_t length = std::min(n - i - 1, this->hairpin_elements.get_max_span());
+		
+		this->get_hairpin_loop_elements(i, length, elements.data());
+		energy_type *row = this->hairpin_elements.row(i);
+		for(size_t k = 0; k < length; k++)
+		{
+			row[k] = Energy::from_kcal(elements[k]);
+		}
+		
+		this->get_stacking_pair_elements(i, length, elements.data());
+		row = this->stacking_elements.row(i);
+		for(size_t k = 0; k < length; k++)
+		{
+			row[k] = Energy::from_kcal(elements[k]);
+		}
+	}
 }
 
 
@@ -84,39 +158,176 @@ Zuker::Zuker(Settings &arg_settings, Sequence &arg_sequence, ReadData &arg_therm
 /**
  * @brief Calculate the Gibbs free energy; fill the matrices Vij and Wij.
  *
- * @section DESCRIPTION a new format, having been standardized in 2008 based
- * The Vij, Wij and Mij matrix are filled in this function. This is done
- * by walking over the diagonals of the matrix to avoid a recursive
- * explosion. Each position in a diagnoal can be calculated independently
- * from each other.
+ * @section DESCRIPTION
+ * The Vij, Wij and Mij matrix are filled in this function. Position
+ * (i,j) only depends on positions (i',j') with i <= i' and j' <= j.
+ * The matrix is therefore divided into square tiles of
+ * settings.tile_size * settings.tile_size positions, and the tiles are
+ * filled walking over the diagonals of tiles. All tiles on one such
+ * diagonal can be calculated independently from each other, so only
+ * one synchronisation point per diagonal of tiles is needed.
+ *
+ * With a tile size of 1 this is identical to walking over the diagonals
+ * of the matrix itself.
+ *
+ * With a maximum span only the diagonals of tiles that intersect the
+ * band are filled, and the exterior loop is calculated afterwards.
  *
  * @todo Return: energy at i,j
  */
-float Zuker::energy(void)
+template <class Energy, class Features>
+float ZukerEngine<Energy, Features>::energy(void)
 {
-	unsigned int i = 0;
-	unsigned int k = 0;
+	size_t tile_size = std::max((unsigned int) 1, this->settings.tile_size);
+	size_t n_tiles = (this->sequence.size() + tile_size - 1) / tile_size;
 	
-	for(k = 1; k < this->sequence.size(); k++)
+	// On diagonal d > 0 of tiles the smallest j - i is (d - 1) * tile_size + 1
+	size_t n_diagonals = n_tiles;
+	if(this->max_span > 0)
 	{
-		// Paralelization / threading: "still reachable" memory error seems normal (http://stackoverflow.com/questions/6973489/valgrind-and-openmp-still-reachable-and-possibly-lost-is-that-bad).. -num_threads can be defined here
-		// http://people.cs.pitt.edu/~melhem/courses/xx45p/OpenMp.pdf
-		// For each element in a diagonal, it can be calculated independent of the others - if num_threads = 0, it will take all possible threads
-		
-		#pragma omp parallel for num_threads(this->settings.num_threads) private(i)
-		for(i = 0; i < this->sequence.size() - k; i++)
+		n_diagonals = std::min(n_tiles, (this->max_span - 1) / tile_size + 2);
+	}
+	
+	// Paralelization / threading: "still reachable" memory error seems normal (http://stackoverflow.com/questions/6973489/valgrind-and-openmp-still-reachable-and-possibly-lost-is-that-bad).. -num_threads can be defined here
+	// http://people.cs.pitt.edu/~melhem/courses/xx45p/OpenMp.pdf
+	// One parallel region for the entire fill; the implicit barrier of the 'omp for' separates the diagonals of tiles - if num_threads = 0, it will take all possible threads
+	#pragma omp parallel num_threads(this->settings.num_threads)
+	{
+		for(size_t d = 0; d < n_diagonals; d++)
 		{
-			Pair pair(i, i + k);// j = i + k
-			this->w(pair);//this->w(i, i + k);
+			#pragma omp for schedule(dynamic, 1)
+			for(size_t t = 0; t < n_tiles - d; t++)
+			{
+				this->energy_tile(t, t + d, tile_size);
+			}
 		}
 	}
 	
-	Pair pair = Pair(0, this->sequence.size() - 1);
+	return this->energy(0, this->sequence.size());
+}
+
+
+
+/**
+ * @brief Minimum free energy of the window begin...end-1; the matrices must be filled by energy()
+ *
+ * @section DESCRIPTION
+ * Sets the window that traceback() traces back. Without maximum span
+ * this is W(begin, end - 1). With a maximum span the exterior loop of
+ * the window is calculated, in O((end - begin) * max_span).
+ *
+ * @param begin First position of the window
+ * @param end Position after the last position of the window
+ *
+ * @return The minimum free energy in kcal/mol
+ */
+template <class Energy, class Features>
+float ZukerEngine<Energy, Features>::energy(size_t begin, size_t end)
+{
+	this->structure_begin = begin;
+	this->structure_end = end;
+	
+	if(this->max_span > 0)
+	{
+		this->energy_exterior();
+	}
+	
+	return Energy::to_kcal(this->structure_energy());
+}
+
+
+
+/**
+ * @brief Minimum free energy of the window; W(begin,end-1), or the exterior loop with a maximum span
+ */
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::structure_energy(void)
+{
+	if(this->max_span > 0)
+	{
+		return this->exterior.back();
+	}
+	
+	Pair pair = Pair((unsigned int) this->structure_begin, (unsigned int) this->structure_end - 1);
 	return this->wij.get(pair);
 }
 
 
 
+/**
+ * @brief Fills the positions (i,j), i < j, of one tile of the matrices.
+ *
+ * @section DESCRIPTION
+ * Within the tile, i goes down and j goes up so that all positions a
+ * position depends on are calculated before it. With a maximum span
+ * only V and WM are filled, for the positions within the band.
+ *
+ * @param tile_i Row of the tile; covers i in [tile_i * tile_size, (tile_i + 1) * tile_size)
+ * @param tile_j Column of the tile; covers j in [tile_j * tile_size, (tile_j + 1) * tile_size)
+ * @param tile_size Width and height of a tile
+ */
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::energy_tile(size_t tile_i, size_t tile_j, size_t tile_size)
+{
+	size_t n = this->sequence.size();
+	
+	size_t i_begin = tile_i * tile_size;
+	size_t i_end = std::min(i_begin + tile_size, n);
+	size_t j_begin = tile_j * tile_size;
+	size_t j_end = std::min(j_begin + tile_size, n);
+	
+	for(size_t i = i_end; i-- > i_begin;)
+	{
+		if(this->max_span == 0)
+		{
+			for(size_t j = std::max(j_begin, i + 1); j < j_end; j++)
+			{
+				Pair pair((unsigned int) i, (unsigned int) j);
+				this->w(pair);
+			}
+		}
+		else
+		{
+			for(size_t j = std::max(j_begin, i + 1); j < std::min(j_end, i + this->max_span + 1); j++)
+			{
+				Pair pair((unsigned int) i, (unsigned int) j);
+				this->fill_v(pair);
+				this->wm(pair);
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Calculates the exterior loop of the window from the band of V; used instead of W with a maximum span
+ *
+ * @section DESCRIPTION
+ * exterior[k] is the minimum free energy of begin...begin+k-1, in
+ * which every pair spans at most max_span nucleotides. For j = begin + k:
+ *
+ * exterior[k + 1] = min(exterior[k], min over i of exterior[i - begin] + V(i,j))
+ *
+ * Every position only depends on the positions before it, so this is
+ * calculated sequentially after the band has been filled.
+ */
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::energy_exterior(void)
+{
+	traceback_jump tmp_tij;
+	
+	this->exterior.assign(this->structure_end - this->structure_begin + 1, 0);
+	this->v_column.resize(this->max_span + 1);
+	
+	for(size_t j = this->structure_begin; j < this->structure_end; j++)
+	{
+		this->exterior[j - this->structure_begin + 1] = this->exterior_decompose(j, tmp_tij);
+	}
+}
+
+
+
 /**
  * @brief Vij Function - energy if (i,j) pair, otherwise return infinity
  *
@@ -124,34 +335,71 @@ float Zuker::energy(void)
  *
  * @return amount of Gibbs free energy provided for folding nucleotide i with j assuming i and j are paired
  */
-float Zuker::v(Pair &p1, PairingPlus &p1p)
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::v(Pair &p1, PairingPlus &p1p)
 {
 #if DEBUG
-	if(this->tij_v.get(p1).target.first != (unsigned int) NOT_YET_CALCULATED)
+	if(this->store_traceback && this->tij_v.get(p1).target.first != (unsigned int) NOT_YET_CALCULATED)
 	{
 		throw std::invalid_argument("Zuker::v(" + std::to_string(p1.first) + ", " + std::to_string(p1.second) + "): redundant calculation, please request values from the ScoringMatrix directly");
 	}
 	
-	if(!p1p.is_canonical() || (p1p.size) < this->settings.minimal_hairpin_length)
+	if(!p1p.is_canonical() || (p1p.size) < this->minimal_hairpin_length())
 	{
 		throw std::invalid_argument("Zuker::v(" + std::to_string(p1.first) + ", " + std::to_string(p1.second) + "): this pair should never be checked within this function because it's energy is infinity by definition");
 	}
 #endif //DEBUG
 	
-	float energy, tmp, tmp_k;
+	traceback_jump tmp_tij;
+	SegmentTraceback *tmp_segmenttraceback;
+	energy_type energy = this->v_decompose(p1, p1p, tmp_tij, tmp_segmenttraceback);
+	
+	if(this->store_traceback)
+	{
+		this->tij_v.set(p1, tmp_tij);
+		if(tmp_segmenttraceback != nullptr)
+		{
+			this->sij.set(p1, tmp_segmenttraceback);
+		}
+	}
+	
+	this->vij.set(p1, energy);
+	return energy;
+}
+
+
+
+/**
+ * @brief Finds the optimal decomposition of (i,j), assuming i and j are paired
+ *
+ * @section DESCRIPTION
+ * Only reads from the matrices, so that it can be used by both the fill
+ * and the traceback. Ties are resolved by the first decomposition
+ * found, which makes the result deterministic.
+ *
+ * @param p1 A pair of positions refering to Nucleotide positions in the sequence, where pi.first < p1.second
+ * @param arg_jump Set to the jump of the optimal decomposition
+ * @param arg_segment_traceback Set to the traceback of the Segment or SegmentLoop of the optimal decomposition; nullptr if there is none
+ *
+ * @return amount of Gibbs free energy provided for folding nucleotide i with j assuming i and j are paired
+ */
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::v_decompose(Pair &p1, PairingPlus &p1p, traceback_jump &arg_jump, SegmentTraceback *&arg_segment_traceback)
+{
+	energy_type energy, tmp, tmp_k;
 	
 	Segment *tmp_segment;
 	SegmentLoop *tmp_segmentloop;
 	SegmentTraceback  *tmp_segmenttraceback = nullptr;
 	
-	energy = this->get_hairpin_loop_element(p1);						// Hairpin element
+	energy = this->hairpin_elements.get(p1);						// Hairpin element
 	traceback_jump tmp_tij = traceback_jump {{UNBOUND, UNBOUND}, V_MATRIX};
 	
 	
 	// Stacking element
 	Pair p2 = Pair(p1.first + 1, p1.second - 1);
-	float v_ij_jp = this->vij.get(p2);
-	tmp = this->get_stacking_pair_element(p1) + v_ij_jp;
+	energy_type v_ij_jp = this->vij.get(p2);
+	tmp = this->stacking_elements.get(p1) + v_ij_jp;
 	if(tmp < energy)
 	{
 		energy = tmp;
@@ -159,11 +407,10 @@ float Zuker::v(Pair &p1, PairingPlus &p1p)
 	}
 	
 	// SegmentLoop element
-	SubSequence ps1 = this->sequence.ssubseq(p2.first, p2.second); ///@todo use Pair()
-	tmp_segmentloop = this->thermodynamics.segmentloops.search(ps1);
+	tmp_segmentloop = Features::segmentloops ? this->thermodynamics.segmentloops.search(this->packed_sequence, p2.first, p2.second - p2.first + 1) : nullptr;
 	if(tmp_segmentloop != nullptr)
 	{
-		tmp_k = tmp_segmentloop->gibbs_free_energy + this->get_stacking_pair_without_surrounding(p1p);
+		tmp_k = Energy::from_kcal(tmp_segmentloop->gibbs_free_energy + this->get_stacking_pair_without_surrounding(p1p));
 		if(tmp_k < energy)
 		{
 			energy = tmp_k;
@@ -171,89 +418,138 @@ float Zuker::v(Pair &p1, PairingPlus &p1p)
 		}
 	}
 	
-	// L-bulge
+	// Largest number of unpaired nucleotides in a bulge or interior loop; a loop can not be larger than the sequence
+	unsigned int max_loop = (this->settings.maximal_loop_length > 0) ? this->settings.maximal_loop_length : (unsigned int) this->sequence.size();
+	
+	// The loops below only visit the (i',j') that can pair; the bulges and interior loops are scanned
+	// in the bitset of a single row, in the same order as a scan over all positions would visit them.
+	size_t k, k_bound;
+	
+	// L-bulge: i' in [i + 2, min(j - 1, i + 2 + max_loop)) that pair with j' = j - 1
 	p2.second = p1.second - 1;
-	for(p2.first = p1.first + 2; p2.first < p2.second; p2.first++)
+	k_bound = std::min((size_t) p2.second, (size_t) p1.first + 2 + max_loop);
+	for(k = p1.first + 2; this->pairings.next(p2.second, k, k_bound); k++)
 	{
-		PairingPlus pairing2 = PairingPlus(this->sequence_begin + p2.first, this->sequence_begin + p2.second);
-		if(pairing2.is_canonical())
+		p2.first = (unsigned int) k;
+		v_ij_jp = this->vij.get(p2);
+		Region region = Region {p1, p2};
+		
+		tmp = Energy::from_kcal(this->get_bulge_loop_element(region)) + v_ij_jp;
+		if(tmp < energy)
 		{
-			v_ij_jp = this->vij.get(p2);
-			Region region = Region {p1, p2};
-			
-			tmp = this->get_bulge_loop_element(region) + v_ij_jp;
-			if(tmp < energy)
-			{
-				energy = tmp;
-				tmp_tij.target = p2;
-				//tmp_segmenttraceback = nullptr;
-			}
+			energy = tmp;
+			tmp_tij.target = p2;
+			//tmp_segmenttraceback = nullptr;
 		}
 	}
 	
-	// R-bulge
+	// R-bulge: j' in [max(i + 2, j - 1 - max_loop), j - 2] that pair with i' = i + 1, descending
 	p2.first = p1.first + 1;
-	for(p2.second = p1.second - 2; p2.second > p2.first; p2.second--)
+	ScoringMatrixSpan<energy_type> v_row = this->vij.row_span(p2.first);
+	k_bound = std::max((size_t) p2.first + 1, (p1.second - 1 > max_loop) ? (size_t)(p1.second - 1 - max_loop) : 0);
+	for(k = p1.second - 1; this->pairings.previous(p2.first, k, k_bound);)
 	{
-		PairingPlus pairing2 = PairingPlus(this->sequence_begin + p2.first, this->sequence_begin + p2.second);
-		if(pairing2.is_canonical())
+		p2.second = (unsigned int) k;
+		v_ij_jp = v_row[k - p2.first - 1];
+		Region region = Region {p1, p2};
+		
+		tmp = Energy::from_kcal(this->get_bulge_loop_element(region)) + v_ij_jp;
+		if(tmp < energy)
 		{
-			v_ij_jp = this->vij.get(p2);
-			Region region = Region {p1, p2};
-			
-			tmp = this->get_bulge_loop_element(region) + v_ij_jp;
-			if(tmp < energy)
-			{
-				energy = tmp;
-				tmp_tij.target = p2;
-				//tmp_segmenttraceback = nullptr;
-			}
+			energy = tmp;
+			tmp_tij.target = p2;
+			//tmp_segmenttraceback = nullptr;
 		}
 	}
 	
 	// Interior or Segment
-	for(p2.first = p1.first + 2; p2.first < p1.second; p2.first++)
+	// An interior loop has l1 + l2 <= max_loop unpaired nucleotides (l1, l2 >= 1). A segment has l1
+	// and l2 bound by the longest segment sequences instead, so that segments are never pruned.
+	// The segments that fit in (i,j) are looked up in the index, sorted in the same order as this loop.
+	unsigned int max_segment_5p = Features::segments ? (unsigned int) this->thermodynamics.segments.max_size(Direction::FivePrime) : 0;
+	unsigned int l1;
+	
+	std::vector<segment_candidate>::iterator candidate, candidates_end;
+	if(Features::segments)
 	{
-		for(p2.second = p1.second - 2; p2.second > p2.first; p2.second--)
+		this->segment_index.search(p1, candidate, candidates_end);
+	}
+	
+	// The interior loops of a row (fixed i') are evaluated in batches of the j' that pair with i',
+	// descending, and reduced with MinPlus. The segments of the row are merged afterwards; at equal
+	// energy the first one visited in the order of a scan over j' wins, and an interior loop comes
+	// before a segment at the same (i',j').
+	size_t positions[ZUKER_INTERIOR_BLOCK];
+	float elements[ZUKER_INTERIOR_BLOCK];
+	energy_type interior[ZUKER_INTERIOR_BLOCK];
+	energy_type v_interior[ZUKER_INTERIOR_BLOCK];
+	size_t n_block, m, argmin;
+	bool interior_found;
+	
+	for(p2.first = p1.first + 2, l1 = 1; p2.first < p1.second && (l1 < max_loop || l1 <= max_segment_5p); p2.first++, l1++)
+	{
+		v_row = this->vij.row_span(p2.first);
+		
+		// Interior: j' in [max(i' + 1, j - 1 - (max_loop - l1)), j - 2] that pair with i'
+		interior_found = false;
+		if(l1 < max_loop)
 		{
-			PairingPlus pairing2 = PairingPlus(this->sequence_begin + p2.first, this->sequence_begin + p2.second);
-			if(pairing2.is_canonical())									// The following structure elements must be enclosed by pairings on both sides
+			k = p1.second - 1;
+			k_bound = std::max((size_t) p2.first + 1, (p1.second - 1 > max_loop - l1) ? (size_t)(p1.second - 1 - (max_loop - l1)) : 0);
+			
+			do
 			{
-				v_ij_jp = this->vij.get(p2);
-				Region region = Region {p1, p2};
-				
-				tmp = this->get_interior_loop_element(region) + v_ij_jp;
-				if(tmp < energy)
+				for(n_block = 0; n_block < ZUKER_INTERIOR_BLOCK && this->pairings.previous(p2.first, k, k_bound); n_block++)
 				{
-					energy = tmp;
-					
-					tmp_tij.target = p2;
-					tmp_segmenttraceback = nullptr;
-					//tmp_tij.target_matrix = V_MATRIX;
+					positions[n_block] = k;
 				}
 				
-				// Find segments:
-				SubSequence pp1 = this->sequence.ssubseq(p1.first + 1, p2.first - 1);
-				SubSequence pp2 = this->sequence.ssubseq(p2.second + 1, p1.second - 1);
-				tmp_segment = this->thermodynamics.segments.search(pp1, pp2);
+				this->get_interior_loop_elements(p1, p2.first, positions, n_block, elements);
+				for(m = 0; m < n_block; m++)
+				{
+					interior[m] = Energy::from_kcal(elements[m]);
+					v_interior[m] = v_row[positions[m] - p2.first - 1];
+				}
 				
-				if(tmp_segment != nullptr)
+				if(MinPlus::reduce(interior, v_interior, n_block, energy, argmin))
 				{
-					tmp_k = tmp_segment->gibbs_free_energy + this->get_stacking_pair_without_surrounding(p1p) + v_ij_jp;
+					interior_found = true;
 					
-					if(tmp_k < energy)
-					{
-						energy = tmp_k;
-						
-						tmp_tij.target = p2;
-						tmp_segmenttraceback = &tmp_segment->traceback;
-						//tmp_tij.target_matrix = V_MATRIX;
-					}
+					tmp_tij.target = Pair(p2.first, (unsigned int) positions[argmin]);
+					tmp_segmenttraceback = nullptr;
+					//tmp_tij.target_matrix = V_MATRIX;
 				}
 			}
+			while(n_block == ZUKER_INTERIOR_BLOCK);
+		}
+		
+		// Segment
+		for(; Features::segments && candidate != candidates_end && candidate->p2.first == p2.first; ++candidate)
+		{
+			p2.second = candidate->p2.second;
+			v_ij_jp = v_row[p2.second - p2.first - 1];
+			
+			tmp_segment = candidate->segment;
+			tmp_k = Energy::from_kcal(tmp_segment->gibbs_free_energy + this->get_stacking_pair_without_surrounding(p1p)) + v_ij_jp;
+			
+			if(tmp_k < energy || (tmp_k == energy && interior_found && tmp_segmenttraceback == nullptr && p2.second > tmp_tij.target.second))
+			{
+				energy = tmp_k;
+				
+				tmp_tij.target = p2;
+				tmp_segmenttraceback = &tmp_segment->traceback;
+				//tmp_tij.target_matrix = V_MATRIX;
+			}
 		}
 	}
 	
+#if DEBUG
+	if(Features::segments && candidate != candidates_end)
+	{
+		throw std::invalid_argument("Zuker::v(" + std::to_string(p1.first) + ", " + std::to_string(p1.second) + "): segment candidate (" + std::to_string(candidate->p2.first) + ", " + std::to_string(candidate->p2.second) + ") was not visited");
+	}
+#endif //DEBUG
+	
 	
 	//this->settings.minimal_hairpin_length)
 	/*   CAA
@@ -264,28 +560,20 @@ float Zuker::v(Pair &p1, PairingPlus &p1p)
 	 *    AA
 	 *
 	 */
-	// Multi-loop - comparison part of the loop looks weird, but otherwise it may become negative while it's unsigned
-	for(
-		p2.first = p1.first + 2 + this->settings.minimal_hairpin_length;
-		p2.first + 2 + this->settings.minimal_hairpin_length < p1.second;
-		p2.first++)
+	// Multi-loop: min over k in [i + 2 + h, j - 3 - h] of WM(i+1,k) + WM(k+1,j-1), where h is the minimal hairpin length
+	size_t k_begin = p1.first + 2 + this->minimal_hairpin_length();
+	if(k_begin + 2 + this->minimal_hairpin_length() < p1.second)
 	{
-#if DEBUG
-		///@todo use minimal hairpin size as well - be aware of unsigned int
-		if(p1.first + 1 >= p2.first || p2.first >= p1.second - 2)
-		{
-			throw std::invalid_argument("Zuker::v(" + std::to_string(p1.first) + ", " + std::to_string(p1.second) + ") -> m(" + std::to_string(p1.first + 1) + ", " + std::to_string(p2.first) + ", " + std::to_string(p2.first + 1) + ", " + std::to_string(p1.second - 1) + "): incorrect loop size");
-		}
-#endif //DEBUG
-		Pair p3 = Pair(p1.first + 1, p2.first);
-		Pair p4 = Pair(p2.first + 1, p1.second - 1);
-		tmp = this->wmij.get(p3) + this->wmij.get(p4);
+		ScoringMatrixSpan<energy_type> wm_row = this->wmij.row_span(p1.first + 1);
+		ScoringMatrixSpan<energy_type> wm_column = this->wmij.column_span(p1.second - 1);
+		size_t n_k = p1.second - 2 - this->minimal_hairpin_length() - k_begin;
+		size_t argmin;
 		
-		if(tmp < energy)
+		if(MinPlus::reduce(wm_row.range(k_begin - p1.first - 2, n_k), wm_column.range(k_begin + 1, n_k), n_k, energy, argmin))
 		{
-			energy = tmp;
+			unsigned int k = (unsigned int)(k_begin + argmin);
 			
-			tmp_tij.target = {p2.first, p2.first};
+			tmp_tij.target = {k, k};
 			tmp_tij.target_matrix = WM_MATRIX;
 			tmp_segmenttraceback = nullptr;
 		}
@@ -298,13 +586,9 @@ float Zuker::v(Pair &p1, PairingPlus &p1p)
 	}
 #endif //DEBUG
 	
-	this->tij_v.set(p1, tmp_tij);
-	if(tmp_segmenttraceback != nullptr && tmp_tij.target_matrix != WM_MATRIX)
-	{
-		this->sij.set(p1, tmp_segmenttraceback);
-	}
+	arg_jump = tmp_tij;
+	arg_segment_traceback = tmp_segmenttraceback;
 	
-	this->vij.set(p1, energy);
 	return energy;
 }
 
@@ -317,7 +601,8 @@ float Zuker::v(Pair &p1, PairingPlus &p1p)
  *
  * @return amount of Gibbs free energy provided for folding nucleotide i with j
  */
-float Zuker::w(Pair &p1)
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::w(Pair &p1)
 {
 #if DEBUG
 	if(p1.first >= p1.second)
@@ -325,41 +610,74 @@ float Zuker::w(Pair &p1)
 		throw std::invalid_argument("Zuker::w(" + std::to_string(p1.first) + ", " + std::to_string(p1.second) + "): out of bound");
 	}
 	
-	if(this->tij_w.get(p1).target.first != (unsigned int) NOT_YET_CALCULATED)
+	if(this->store_traceback && this->tij_w.get(p1).target.first != (unsigned int) NOT_YET_CALCULATED)
 	{
 		throw std::invalid_argument("Zuker::w(" + std::to_string(p1.first) + ", " + std::to_string(p1.second) + "): redundant calculation, please request values from the ScoringMatrix directly");
 	}
 #endif //DEBUG
 	
-	float energy;
-	signed int tmp_pij, tmp_qij;
-	unsigned int n = (p1.second - p1.first);
+	this->fill_v(p1);
 	
+	traceback_jump tmp_tij;
+	energy_type energy = this->w_decompose(p1, tmp_tij);
 	
-	energy = 0.0;
-	tmp_pij = UNBOUND;
-	PairingPlus p1p = PairingPlus(this->sequence_begin + p1.first, this->sequence_begin + p1.second);
+	// Calculate it, must be after v()
+	this->wm(p1);
+	this->wij.set(p1, energy);
+	
+	if(this->store_traceback)
+	{
+		this->tij_w.set(p1, tmp_tij);
+	}
 	
-	if(n <= this->settings.minimal_hairpin_length)
+	return energy;
+}
+
+
+
+/**
+ * @brief Fills V at p1; infinity if i and j can not pair
+ */
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::fill_v(Pair &p1)
+{
+	if(p1.second - p1.first <= this->minimal_hairpin_length() || !this->pairings.is_canonical(p1.first, p1.second))
 	{
-		this->vij.set(p1, N_INFINITY);
+		this->vij.set(p1, Energy::infinity());
 	}
 	else
 	{
-		float tmp;
-		
-		if(!p1p.is_canonical())
-		{
-			this->vij.set(p1, N_INFINITY);
-		}
-		else
+		PairingPlus p1p = PairingPlus(this->sequence_begin + p1.first, this->sequence_begin + p1.second);
+		this->v(p1, p1p);
+	}
+}
+
+
+
+/**
+ * @brief Finds the optimal decomposition of sequence i...j; Vij must be calculated
+ *
+ * @param p1 A pair of positions refering to Nucleotide positions in the sequence, where pi.first < p1.second
+ * @param arg_jump Set to the jump of the optimal decomposition
+ *
+ * @return amount of Gibbs free energy provided for folding nucleotide i with j
+ */
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::w_decompose(Pair &p1, traceback_jump &arg_jump)
+{
+	energy_type energy, tmp;
+	unsigned int n = (p1.second - p1.first);
+	
+	energy = 0;
+	arg_jump = {{UNBOUND, UNBOUND}, W_MATRIX};
+	
+	if(n > this->minimal_hairpin_length())
+	{
+		tmp = this->vij.get(p1);
+		if(tmp < energy)
 		{
-			tmp = this->v(p1, p1p);
-			if(tmp < energy)
-			{
-				energy = tmp;
-				tmp_pij = BOUND;
-			}
+			energy = tmp;
+			arg_jump = {p1, V_MATRIX};
 		}
 		
 		
@@ -384,60 +702,41 @@ float Zuker::w(Pair &p1)
 		if(n >= 2)// && tmp_pij != BOUND)// if it is bound, use Vij
 		{
 			Pair p2, p3;
+			ScoringMatrixSpan<energy_type> w_row = this->wij.row_span(p1.first);
+			ScoringMatrixSpan<energy_type> w_column = this->wij.column_span(p1.second);
 			
 			// pre-iter 1
 			p3 = Pair(p1.first + 1, p1.second);
-			tmp = this->wij.get(p3);
+			tmp = w_column[p3.first];
 			if(tmp < energy)
 			{
 				energy = tmp;
-				
-				tmp_pij = (signed int) p3.first;
-				tmp_qij = (signed int) p3.second;
+				arg_jump = {p3, W_MATRIX};
 			}
 			
 			// pre-iter 2
 			p2 = Pair(p1.first, p1.second - 1);
-			tmp = this->wij.get(p2);
+			tmp = w_row[n - 2];
 			if(tmp < energy)
 			{
 				energy = tmp;
-				tmp_pij = (signed int) p2.first;
-				tmp_qij = (signed int) p2.second;
+				arg_jump = {p2, W_MATRIX};
 			}
 			
-			// remaining iterations
-			for(unsigned int k = p1.first + 1; k < p1.second - 1; k++)
+			// remaining iterations: min over k in [i + 1, j - 2] of W(i,k) + W(k+1,j)
+			size_t n_k = n - 2;
+			if(n_k > 0)
 			{
-				p2 = Pair(p1.first, k);
-				p3 = Pair(k + 1, p1.second);
-				
-				tmp = this->wij.get(p2) + this->wij.get(p3);
-				
-				if(tmp < energy)
+				size_t argmin;
+				if(MinPlus::reduce(w_row.range(0, n_k), w_column.range(p1.first + 2, n_k), n_k, energy, argmin))
 				{
-					// Can also be done by checking whether pathmatrix_corrected_from > 0 ? >> and only store those positions in a tree instead of an entire matrix
-					energy = tmp;
-					tmp_pij = (signed int) k;///@todo make tmp_pij unsigned by setting BOUND and UNBOUND to MAX_VAL(size_t)-1 and MAX_VAL(size_t)-2
-					tmp_qij = (signed int) k;///@todo make tmp_pij unsigned by setting BOUND and UNBOUND to MAX_VAL(size_t)-1 and MAX_VAL(size_t)-2
+					unsigned int k = p1.first + 1 + (unsigned int) argmin;
+					arg_jump = {{k, k}, W_MATRIX};
 				}
 			}
 		}
 	}
 	
-	// Calculate it, must be after v()
-	this->wm(p1, p1p);
-	this->wij.set(p1, energy);
-	
-	if(tmp_pij == BOUND)// no oneliner possible
-	{
-		this->tij_w.set(p1, {p1, V_MATRIX});
-	}
-	else
-	{
-		this->tij_w.set(p1, {{tmp_pij, tmp_qij}, W_MATRIX});
-	}
-	
 	return energy;
 }
 
@@ -446,7 +745,8 @@ float Zuker::w(Pair &p1)
 /**
  * @brief Decomposes a multiloop
  */
-float Zuker::wm(Pair &p1, PairingPlus &p1p)
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::wm(Pair &p1)
 {
 #if DEBUG
 	if(p1.first >= p1.second)
@@ -455,51 +755,111 @@ float Zuker::wm(Pair &p1, PairingPlus &p1p)
 	}
 #endif //DEBUG
 	
-	unsigned int k;
-	float tmp;
-	float energy;
+	traceback_jump tmp_tij;
+	energy_type energy = this->wm_decompose(p1, tmp_tij);
+	
+	if(this->store_traceback)
+	{
+		this->tij_wm.set(p1, tmp_tij);
+	}
+	this->wmij.set(p1, energy);
+	
+	return energy;
+}
+
+
+
+/**
+ * @brief Finds the optimal decomposition of a multiloop; Vij must be calculated
+ *
+ * @param p1 A pair of positions refering to Nucleotide positions in the sequence, where pi.first < p1.second
+ * @param arg_jump Set to the jump of the optimal decomposition
+ */
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::wm_decompose(Pair &p1, traceback_jump &arg_jump)
+{
+	energy_type tmp;
+	energy_type energy;
 	energy = this->vij.get(p1);
 	
-	traceback_jump tmp_tij = {p1, V_MATRIX};
-	Pair p2, p3;
+	arg_jump = {p1, V_MATRIX};
+	Pair p2;
+	
+	// The diagonals WM(j,j) and WM(i,i) are read from the padding of the columns
+	ScoringMatrixSpan<energy_type> wm_column = this->wmij.column_span(p1.second);
+	ScoringMatrixSpan<energy_type> wm_column_l = this->wmij.column_span(p1.second - 1);
 	
-	for(k = p1.first + 1; k < p1.second; k++)
+	// min over k in [i + 1, j - 1] of WM(i,k) + WM(k+1,j)
+	size_t n_k = p1.second - p1.first - 1;
+	if(n_k > 0)
 	{
-		p2 = Pair(p1.first, k);
-		p3 = Pair(k + 1, p1.second);
-		tmp = this->wmij.get(p2) + this->wmij.get(p3);
-		
-		if(tmp < energy)
+		size_t argmin;
+		if(MinPlus::reduce(this->wmij.row_span(p1.first).range(0, n_k), wm_column.range(p1.first + 2, n_k), n_k, energy, argmin))
 		{
 			// TB to p2 and p3, as bifurcation
-			energy = tmp;
-			tmp_tij.target = {k, k};
-			tmp_tij.target_matrix = WM_MATRIX; // go back to the v matrix - for both
+			unsigned int k = p1.first + 1 + (unsigned int) argmin;
+			arg_jump.target = {k, k};
+			arg_jump.target_matrix = WM_MATRIX; // go back to the v matrix - for both
 		}
 	}
 	
 	p2 = Pair(p1.first + 1, p1.second);
-	tmp = this->wmij.get(p2);
+	tmp = wm_column[p2.first];
 	if(tmp < energy)
 	{
 		// TB to p1l, not as bifurcation
 		energy = tmp;
-		tmp_tij.target = p2;
-		tmp_tij.target_matrix = WM_MATRIX;//stay in wm
+		arg_jump.target = p2;
+		arg_jump.target_matrix = WM_MATRIX;//stay in wm
 	}
 	
 	p2 = Pair(p1.first, p1.second - 1);
-	tmp = this->wmij.get(p2);
+	tmp = wm_column_l[p2.first];
 	if(tmp < energy)
 	{
 		// TB to p1r, not as bifurcation
 		energy = tmp;
-		tmp_tij.target = p2;
-		tmp_tij.target_matrix = WM_MATRIX;//stay in wm
+		arg_jump.target = p2;
+		arg_jump.target_matrix = WM_MATRIX;//stay in wm
 	}
 	
-	this->tij_wm.set(p1, tmp_tij);
-	this->wmij.set(p1, energy);
+	return energy;
+}
+
+
+
+/**
+ * @brief Finds the optimal decomposition of the exterior loop of begin...j; exterior[0 ... j - begin] must be calculated
+ *
+ * @section DESCRIPTION
+ * Either j is unpaired, or it pairs with an i in
+ * [max(begin, j - max_span), j - h - 1], where h is the minimal hairpin
+ * length. At equal energy j stays unpaired, and otherwise the smallest
+ * i wins.
+ *
+ * @param j Last position of the prefix
+ * @param arg_jump Set to the pair (i,j) in V, or to UNBOUND if j is unpaired
+ *
+ * @return The minimum free energy of 0...j
+ */
+template <class Energy, class Features>
+typename Energy::type ZukerEngine<Energy, Features>::exterior_decompose(size_t j, traceback_jump &arg_jump)
+{
+	energy_type energy = this->exterior[j - this->structure_begin];
+	arg_jump = {{UNBOUND, UNBOUND}, W_MATRIX};
+	
+	size_t i_begin = std::max(this->structure_begin, (j > this->max_span) ? j - this->max_span : 0);
+	if(j > this->minimal_hairpin_length() && i_begin < j - this->minimal_hairpin_length())
+	{
+		size_t n_i = j - this->minimal_hairpin_length() - i_begin;
+		size_t argmin;
+		
+		this->vij.get_column(j, i_begin, i_begin + n_i, this->v_column.data());
+		if(MinPlus::reduce(&this->exterior[i_begin - this->structure_begin], this->v_column.data(), n_i, energy, argmin))
+		{
+			arg_jump = {{(unsigned int)(i_begin + argmin), (unsigned int) j}, V_MATRIX};
+		}
+	}
 	
 	return energy;
 }
@@ -516,18 +876,40 @@ float Zuker::wm(Pair &p1, PairingPlus &p1p)
  * The usage of an additional push and pop system is essential because
  * traces can split up because of forks. Otherwise recursion was
  * essential.
+ *
+ * The jumps are either read from the traceback matrices or, with
+ * settings.traceback_recomputation, recomputed from the energy matrices
+ * (see Zuker::traceback_action). Not available in energy only mode.
+ *
+ * The structure of the window of the last call to energy() is traced
+ * back, by default the entire sequence. With a maximum span the
+ * traceback starts at the pairs of the exterior loop instead of at W.
  */
-void Zuker::traceback(void)
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::traceback(void)
 {
+	if(this->settings.energy_only)
+	{
+		throw std::invalid_argument("Zuker::traceback(): no traceback in energy only mode");
+	}
+	
 	this->folded_segments = 0;
+	this->dot_bracket = DotBracket();
 	
 	SegmentTraceback *independent_segment_traceback;
 	
-	traceback_jump origin = {{0, (unsigned int) this->sequence.size() - 1}, W_MATRIX};
+	traceback_jump origin = {{(unsigned int) this->structure_begin, (unsigned int) this->structure_end - 1}, W_MATRIX};
 	traceback_jump action;
 	
 	// only initize traceback if it provides free energy
-	this->traceback_push(origin);///@todo use size_t
+	if(this->max_span == 0)
+	{
+		this->traceback_push(origin);///@todo use size_t
+	}
+	else
+	{
+		this->traceback_exterior();
+	}
 	while(this->traceback_pop(origin.target.first, origin.target.second, origin.target_matrix))
 	{
 #if DEBUG
@@ -537,37 +919,20 @@ void Zuker::traceback(void)
 		}
 #endif //DEBUG
 		
-		switch(origin.target_matrix)
-		{
-			case V_MATRIX:
-				action = this->tij_v.get(origin.target);
-				break;
-			case W_MATRIX:
-				action = this->tij_w.get(origin.target);
-				break;
-			case WM_MATRIX:
-				action = this->tij_wm.get(origin.target);
-				break;
-#if DEBUG
-			default:
-				throw std::invalid_argument("Zuker::traceback(): (" + std::to_string(origin.target.first) + ", " + std::to_string(origin.target.second) + ") targetting from unset location\n");
-				return void();
-				break;
-#endif //DEBUG
-		}
+		action = this->traceback_action(origin, independent_segment_traceback);
 		
 		// Checks whether the action for the current position is to STORE
 		if(origin.target_matrix == V_MATRIX)
 		{
 			this->dot_bracket.store(origin.target);
 			
-			independent_segment_traceback = this->sij.get(origin.target);///@todo implement it as independent_segment_traceback = this->nij.search(p); or sth like that
 			if(independent_segment_traceback != nullptr)// If a Segment's traceback is found, trace its internal structure back
 			{
 				this->folded_segments++;
 				Pair pair_tmp = origin.target;
+				SegmentTraceback segment_traceback = *independent_segment_traceback;// private copy; segments are shared by concurrent Zuker instances
 				
-				while(independent_segment_traceback->traceback(pair_tmp.first, pair_tmp.second))
+				while(segment_traceback.traceback(pair_tmp.first, pair_tmp.second))
 				{
 #if DEBUG
 					if(pair_tmp.first >= pair_tmp.second)
@@ -609,6 +974,94 @@ void Zuker::traceback(void)
 
 
 
+/**
+ * @brief Pushes the pairs of the exterior loop of the window onto the stack, walking from its 3' end to its 5' end
+ *
+ * @section DESCRIPTION
+ * The exterior loop is only O(n) elements, so its decompositions are
+ * always recomputed instead of stored.
+ */
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::traceback_exterior(void)
+{
+	traceback_jump action;
+	
+	for(size_t j = this->structure_end; j-- > this->structure_begin;)
+	{
+		this->exterior_decompose(j, action);
+		
+		if(action.target.first != (unsigned int) UNBOUND)
+		{
+			this->traceback_push(action);
+			j = action.target.first;
+		}
+	}
+}
+
+
+
+/**
+ * @brief Returns the jump of the optimal decomposition of a position in the V, W or WM matrix
+ *
+ * @section DESCRIPTION
+ * With the traceback matrices the jump is looked up. Otherwise it is
+ * recomputed by the same decomposition functions that filled the energy
+ * matrices, so ties are resolved identically. The traceback only visits
+ * O(n) positions, so this costs O(n) decompositions.
+ *
+ * @param origin Position and matrix to trace back from
+ * @param arg_segment_traceback Set to the traceback of the Segment or SegmentLoop chosen at a position in V; nullptr otherwise
+ */
+template <class Energy, class Features>
+traceback_jump ZukerEngine<Energy, Features>::traceback_action(traceback_jump &origin, SegmentTraceback *&arg_segment_traceback)
+{
+	traceback_jump action;
+	arg_segment_traceback = nullptr;
+	
+	switch(origin.target_matrix)
+	{
+		case V_MATRIX:
+			if(this->store_traceback)
+			{
+				action = this->tij_v.get(origin.target);
+				arg_segment_traceback = this->sij.get(origin.target);
+			}
+			else
+			{
+				PairingPlus p1p = PairingPlus(this->sequence_begin + origin.target.first, this->sequence_begin + origin.target.second);
+				this->v_decompose(origin.target, p1p, action, arg_segment_traceback);
+			}
+			break;
+		case W_MATRIX:
+			if(this->store_traceback)
+			{
+				action = this->tij_w.get(origin.target);
+			}
+			else
+			{
+				this->w_decompose(origin.target, action);
+			}
+			break;
+		case WM_MATRIX:
+			if(this->store_traceback)
+			{
+				action = this->tij_wm.get(origin.target);
+			}
+			else
+			{
+				this->wm_decompose(origin.target, action);
+			}
+			break;
+		default:
+			throw std::invalid_argument("Zuker::traceback(): (" + std::to_string(origin.target.first) + ", " + std::to_string(origin.target.second) + ") targetting from unset location\n");
+			break;
+	}
+	
+	return action;
+}
+
+
+
 /**
  * @brief Pushes (i,j) & matrix-flag onto the stack
  *
@@ -616,7 +1069,8 @@ void Zuker::traceback(void)
  *
  * @todo inline
  */
-void Zuker::traceback_push(traceback_jump arg_jump)
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::traceback_push(traceback_jump arg_jump)
 {
 	this->traceback_stack.push_back(arg_jump);
 }
@@ -634,7 +1088,8 @@ void Zuker::traceback_push(traceback_jump arg_jump)
  *
  * @return True for success; False otherwise.
  */
-bool Zuker::traceback_pop(unsigned int &i, unsigned int &j, char &matrix)
+template <class Energy, class Features>
+bool ZukerEngine<Energy, Features>::traceback_pop(unsigned int &i, unsigned int &j, char &matrix)
 {
 	if(!this->traceback_stack.empty())
 	{
@@ -655,26 +1110,78 @@ bool Zuker::traceback_pop(unsigned int &i, unsigned int &j, char &matrix)
 
 
 /**
- * @brief Prints the 2D structure as DotBracket (dbn) format
+ * @brief Number of Segments and SegmentLoops in the structure of the last traceback
+ */
+template <class Energy, class Features>
+unsigned int ZukerEngine<Energy, Features>::get_folded_segments(void)
+{
+	return this->folded_segments;
+}
+
+
+
+/**
+ * @brief Formats the 2D structure as DotBracket (dbn) format
  *
- * @todo Change this to Zuker::output(), add enum for OutputType::DotBracket / OutputType::ConnectivityTable / OutputType::RNAXml
+ * @section DESCRIPTION
+ * The header contains the name of the FASTA record, if there was one.
+ * In energy only mode there is no structure, so only the header with
+ * the energy and the sequence are given.
+ *
+ * @param output String to which the header, sequence and structure are appended
  */
-void Zuker::print_2D_structure(void)
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::format_2D_structure(std::string &output)
 {
 	size_t n = this->sequence.size();
-	Pair pair = Pair(0, n - 1);
+	
+	const char *name = this->settings.sequence_name.empty() ? "Sequence" : this->settings.sequence_name.c_str();
+	
+	char header[128];
+	if(this->settings.energy_only)
+	{
+		snprintf(header, sizeof(header), " length: %zubp, dE: %.2f kcal/mole\n", n, Energy::to_kcal(this->structure_energy()));
+		
+		output += ">";
+		output += name;
+		output += header;
+		output += this->sequence.str() + "\n";
+		
+		return void();
+	}
 	
 	std::string dotbracket = "";
 	this->dot_bracket.format((unsigned int) n, dotbracket); ///@todo use size_t
 	
-	printf(">Sequence length: %zubp, dE: %.2f kcal/mole, segments: %i\n", n, this->wij.get(pair), this->folded_segments++);
-	std::cout << this->sequence.str() << "\n" << dotbracket << "\n";
+	snprintf(header, sizeof(header), " length: %zubp, dE: %.2f kcal/mole, segments: %i\n", n, Energy::to_kcal(this->structure_energy()), this->folded_segments);
+	
+	output += ">";
+	output += name;
+	output += header;
+	output += this->sequence.str() + "\n" + dotbracket + "\n";
+}
+
+
+
+/**
+ * @brief Prints the 2D structure as DotBracket (dbn) format
+ *
+ * @todo Change this to Zuker::output(), add enum for OutputType::DotBracket / OutputType::ConnectivityTable / OutputType::RNAXml
+ */
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::print_2D_structure(void)
+{
+	std::string output = "";
+	this->format_2D_structure(output);
+	
+	std::cout << output;
 }
 
 
 
 #if DEBUG
-void Zuker::_print_sij(unsigned int matrix_length)
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::_print_sij(unsigned int matrix_length)
 {
 	unsigned int i, j;
 	
@@ -712,7 +1219,8 @@ void Zuker::_print_sij(unsigned int matrix_length)
 
 
 #if DEBUG
-void Zuker::_print_vij(unsigned int matrix_length)
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::_print_vij(unsigned int matrix_length)
 {
 	unsigned int i, j;
 	float p;
@@ -729,7 +1237,7 @@ void Zuker::_print_vij(unsigned int matrix_length)
 			}
 			else
 			{
-				p = this->vij.get(pair);
+				p = Energy::to_kcal(this->vij.get(pair));
 				printf("%8.1f ", p);
 			}
 		}
@@ -748,7 +1256,8 @@ void Zuker::_print_vij(unsigned int matrix_length)
 
 
 #if DEBUG
-void Zuker::_print_wij(unsigned int matrix_length)
+template <class Energy, class Features>
+void ZukerEngine<Energy, Features>::_print_wij(unsigned int matrix_length)
 {
 	unsigned int i, j;
 	float p;
@@ -765,7 +1274,7 @@ void Zuker::_print_wij(unsigned int matrix_length)
 			}
 			else
 			{
-				p = this->wij.get(pair);
+				p = Energy::to_kcal(this->wij.get(pair));
 				printf("%8.1f ", p);
 			}
 		}
@@ -780,3 +1289,17 @@ void Zuker::_print_wij(unsigned int matrix_length)
 	std::cout << "\n\n";
 }
 #endif // DEBUG
+
+
+
+template class ZukerEngine<FloatEnergy>;
+template class ZukerEngine<FloatEnergy, ZukerFeatures<true, false> >;
+template class ZukerEngine<FloatEnergy, ZukerFeatures<false, true> >;
+template class ZukerEngine<FloatEnergy, ZukerFeatures<false, false> >;
+
+template class ZukerEngine<FloatEnergy, ZukerFeatures<true, true, ZUKER_CONSTANT_HAIRPIN_LENGTH> >;
+template class ZukerEngine<FloatEnergy, ZukerFeatures<true, false, ZUKER_CONSTANT_HAIRPIN_LENGTH> >;
+template class ZukerEngine<FloatEnergy, ZukerFeatures<false, true, ZUKER_CONSTANT_HAIRPIN_LENGTH> >;
+template class ZukerEngine<FloatEnergy, ZukerFeatures<false, false, ZUKER_CONSTANT_HAIRPIN_LENGTH> >;
+
+template class ZukerEngine<FixedPointEnergy>;
@@ -54,12 +54,18 @@
 #include "ReadData.hpp"
 #include "ScoringMatrix.hpp"
 #include "Zuker.hpp"
+#include "Scheduler.hpp"
 
 
 
 /**
  * @brief Predicts the structure of an RNA sequence in major 3 steps: 1) obtain parameters from IO, 2) Run the Zuker algorithm, 3) print the 2D structure.
  *
+ * @section DESCRIPTION
+ * The parameters and segments are loaded only once; steps 2 and 3 are
+ * repeated for every record of a multi-FASTA input, where multiple
+ * records are folded concurrently by the Scheduler.
+ *
  * @param argc Number of commandline arguments.
  * @param argv Array of strings with the actual commandline arguments.
  *
@@ -70,23 +76,34 @@ int main(int argc, char *argv[])
 	// Load data
 	Sequence sequence = Sequence();
 	
-	// Set variables
-	Settings settings = Settings(argc, argv, sequence);
-	if(settings.proceed_with_folding)
+	try
 	{
-		ReadData thermodynamics = ReadData();
-		ReadSegments readsegments = ReadSegments(settings.segment_filename);
-		
-		if(settings.segment_prediction_functionality)
+		// Set variables
+		Settings settings = Settings(argc, argv, sequence);
+		if(settings.proceed_with_folding)
 		{
-			readsegments.parse(thermodynamics.segments, thermodynamics.segmentloops);
+			ReadData thermodynamics = ReadData();
+			if(!settings.parameter_filename.empty())
+			{
+				thermodynamics.load(settings.parameter_filename);
+			}
+			
+			ReadSegments readsegments = ReadSegments(settings.segment_filename);
+			
+			if(settings.segment_prediction_functionality)
+			{
+				readsegments.parse(thermodynamics.segments, thermodynamics.segmentloops);
+			}
+			
+			// Run algorithm (filling phase and traceback) per record
+			Scheduler scheduler = Scheduler(settings, sequence, thermodynamics);
+			scheduler.run();
 		}
-		
-		// Run algorithm
-		Zuker zuker = Zuker(settings, sequence, thermodynamics);		// Zuker algorithm
-		zuker.energy();													// - filling phase
-		zuker.traceback();												// - traceback
-		zuker.print_2D_structure();
+	}
+	catch(std::invalid_argument &e)										// invalid arguments (after the usage) or sequences
+	{
+		std::cerr << "Error: " << e.what() << "\n";
+		return 1;
 	}
 	
 	return 0;
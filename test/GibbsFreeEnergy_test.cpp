@@ -310,6 +310,56 @@ BOOST_AUTO_TEST_CASE(TestHairpinLoop6)
 	BOOST_CHECK_EQUAL(gfe2.get_hairpin_loop_element(p2), (energy_gggu_loop  + energy_gu_pairing + energy_tloop_mask + energy_loop_hairpin));
 	BOOST_CHECK_EQUAL(gfe3.get_hairpin_loop_element(p3), (energy_gu_pairing + energy_tloop_mask + energy_loop_hairpin));
 }
+
+
+/**
+ * @brief Tests whether the rows of hairpin and stacking elements are bit-exact equal to the elements per pair
+ *
+ * @section DESCRIPTION
+ * The sequence contains poly-C loops, GGG...U loops, triloops and
+ * tetraloops, and is long enough for extrapolated hairpin loops.
+ *
+ * @test GibbsFreeEnergy::get_hairpin_loop_elements
+ * @test GibbsFreeEnergy::get_stacking_pair_elements
+ */
+BOOST_AUTO_TEST_CASE(TestElementRows)
+{
+	Sequence rna = Sequence("GGGCCCCCUAGGGAAACUGAGGGGAGAUCCCCCCCCGAUCGUGAAAACACGGGUUUCGACCUAGCUCCCUAAAGGGAUGCAUUGGGACGUUCUCGAGCCCCAGGU");
+	size_t n = rna.size();
+	
+	ReadData thermodynamics = ReadData();
+	GibbsFreeEnergy gfe = GibbsFreeEnergy(rna, thermodynamics);
+	
+	std::vector<float> hairpin = std::vector<float>(n);
+	std::vector<float> stacking = std::vector<float>(n);
+	
+	for(size_t i = 0; i + 1 < n; i++)
+	{
+		gfe.get_hairpin_loop_elements(i, n - i - 1, hairpin.data());
+		gfe.get_stacking_pair_elements(i, n - i - 1, stacking.data());
+		
+		for(size_t j = i + 1; j < n; j++)
+		{
+			Pair p = Pair((unsigned int) i, (unsigned int) j);
+			Pairing pairing = Pairing(rna[i], rna[j]);
+			
+			if(pairing.is_canonical())
+			{
+				float expected_hairpin = gfe.get_hairpin_loop_element(p);
+				float expected_stacking = gfe.get_stacking_pair_element(p);
+				
+				BOOST_CHECK(memcmp(&hairpin[j - i - 1], &expected_hairpin, sizeof(float)) == 0);
+				BOOST_CHECK(memcmp(&stacking[j - i - 1], &expected_stacking, sizeof(float)) == 0);
+			}
+			else
+			{
+				BOOST_CHECK_EQUAL(hairpin[j - i - 1], N_INFINITY);
+				BOOST_CHECK_EQUAL(stacking[j - i - 1], N_INFINITY);
+			}
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(TestingBulgeloop)
@@ -1896,6 +1946,65 @@ BOOST_AUTO_TEST_CASE(TestInteriorLoop7)
 }
 
 
+
+/**
+ * @brief Tests whether batches of interior loop elements are bit-exact equal to the elements per loop
+ *
+ * @section DESCRIPTION
+ * Covers the 1x1, 1x2, 2x1 and 2x2 loops, the generic loops with and
+ * without asymmetry and the loops closing a too small hairpin, for all
+ * canonical (i,j) and (i',j') with at most 30 unpaired nucleotides.
+ *
+ * @test GibbsFreeEnergy::get_interior_loop_elements
+ */
+BOOST_AUTO_TEST_CASE(TestInteriorLoopElements)
+{
+	Sequence rna = Sequence("GGGCCCCCUAGGGAAACUGAGGGGAGAUCCCCCCCCGAUCGUGAAAACACGGGUUUCGACCUAGCUCCCUAAAGGGAUGCAUUGGGACGUUCUCGAGCCCCAGGU");
+	size_t n = rna.size();
+	
+	ReadData thermodynamics = ReadData();
+	GibbsFreeEnergy gfe = GibbsFreeEnergy(rna, thermodynamics);
+	
+	std::vector<size_t> positions;
+	std::vector<float> elements = std::vector<float>(n);
+	
+	for(size_t i = 0; i < n; i++)
+	{
+		for(size_t j = i + 4; j < n; j++)
+		{
+			Pair p1 = Pair((unsigned int) i, (unsigned int) j);
+			if(!Pairing(rna[i], rna[j]).is_canonical())
+			{
+				continue;
+			}
+			
+			for(size_t ip = i + 2; ip + 2 < j; ip++)
+			{
+				// j' descending, in the order of Zuker::v()
+				positions.clear();
+				for(size_t jp = j - 2; jp > ip && (ip - i - 1) + (j - 1 - jp) <= 30; jp--)
+				{
+					if(Pairing(rna[ip], rna[jp]).is_canonical())
+					{
+						positions.push_back(jp);
+					}
+				}
+				
+				gfe.get_interior_loop_elements(p1, ip, positions.data(), positions.size(), elements.data());
+				
+				for(size_t m = 0; m < positions.size(); m++)
+				{
+					Pair p2 = Pair((unsigned int) ip, (unsigned int) positions[m]);
+					Region r = Region {p1, p2};
+					float expected = gfe.get_interior_loop_element(r);
+					
+					BOOST_CHECK(memcmp(&elements[m], &expected, sizeof(float)) == 0);
+				}
+			}
+		}
+	}
+}
+
 ///@todo final check: check whether the relative maximum hairpin size fits with the length of the interpolated hairpin loop penalty vector
 
 ///@todo test GibbsFreeEnergy::get_stacking_pair_element(Pair &arg_pair)
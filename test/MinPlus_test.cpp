@@ -0,0 +1,185 @@
+/**
+ * @file test/MinPlus_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#define BOOST_TEST_MODULE MinPlus
+
+
+
+#include "main.hpp"
+
+#include "Energy.hpp"
+#include "MinPlus.hpp"
+
+#include <boost/test/included/unit_test.hpp>
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+/**
+ * @brief Tests the scalar kernel on a small example, including ties and a minimum that is not smaller than the given energy
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test01)
+{
+	std::vector<float> a = {1.0f, -2.0f, 0.5f, -2.5f, 3.0f};
+	std::vector<float> b = {1.0f, -1.0f, -3.5f, 0.0f, -6.0f};
+	
+	float energy = 0.0f;
+	size_t argmin = 99;
+	
+	BOOST_CHECK(MinPlus::scalar(a.data(), b.data(), a.size(), energy, argmin));
+	BOOST_CHECK_EQUAL(energy, -3.0f);
+	BOOST_CHECK_EQUAL(argmin, 1);// first of the three positions with -3.0
+	
+	energy = -3.0f;
+	argmin = 99;
+	BOOST_CHECK(!MinPlus::scalar(a.data(), b.data(), a.size(), energy, argmin));
+	BOOST_CHECK_EQUAL(energy, -3.0f);
+	BOOST_CHECK_EQUAL(argmin, 99);
+	
+	BOOST_CHECK(!MinPlus::scalar(a.data(), b.data(), 0, energy, argmin));
+}
+
+
+
+/**
+ * @brief Tests whether the vectorized kernels are bit-exact equal to the scalar kernel, for all lengths and many ties
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test02)
+{
+	std::vector<min_plus_kernel> kernels = {&MinPlus::reduce};
+	if(MinPlus::has_sse2())
+	{
+		kernels.push_back(&MinPlus::sse2);
+	}
+	if(MinPlus::has_avx2())
+	{
+		kernels.push_back(&MinPlus::avx2);
+	}
+	
+	unsigned int seed = 1;
+	for(size_t n = 0; n < 80; n++)
+	{
+		for(size_t repeat = 0; repeat < 25; repeat++)
+		{
+			std::vector<float> a = std::vector<float>(n);
+			std::vector<float> b = std::vector<float>(n);
+			
+			for(size_t k = 0; k < n; k++)
+			{
+				// few distinct values for many ties, infinities as in the W and WM matrices and fractions that are not exact in binary
+				seed = seed * 1103515245 + 12345;
+				unsigned int r = (seed >> 16) % 12;
+				
+				a[k] = (r == 0) ? N_INFINITY : (float) r * -0.1f;
+				b[k] = (r == 1) ? N_INFINITY : (float)(r % 5) * -0.3f;
+			}
+			
+			std::vector<float> energies = {0.0f, N_INFINITY, -1.5f};
+			for(std::vector<float>::iterator initial = energies.begin(); initial != energies.end(); ++initial)
+			{
+				float energy_reference = *initial;
+				size_t argmin_reference = 999;
+				bool found_reference = MinPlus::scalar(a.data(), b.data(), n, energy_reference, argmin_reference);
+				
+				for(std::vector<min_plus_kernel>::iterator kernel = kernels.begin(); kernel != kernels.end(); ++kernel)
+				{
+					float energy = *initial;
+					size_t argmin = 999;
+					bool found = (*kernel)(a.data(), b.data(), n, energy, argmin);
+					
+					BOOST_REQUIRE_EQUAL(found, found_reference);
+					BOOST_REQUIRE_EQUAL(argmin, argmin_reference);
+					BOOST_REQUIRE(memcmp(&energy, &energy_reference, sizeof(float)) == 0);
+				}
+			}
+		}
+	}
+}
+
+
+/**
+ * @brief Tests whether the integer kernels are equal to the integer scalar kernel, for all lengths and many ties
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test03)
+{
+	std::vector<min_plus_kernel_int32> kernels = {&MinPlus::reduce};
+	if(MinPlus::has_sse2())
+	{
+		kernels.push_back(&MinPlus::sse2);
+	}
+	if(MinPlus::has_avx2())
+	{
+		kernels.push_back(&MinPlus::avx2);
+	}
+	
+	unsigned int seed = 1;
+	for(size_t n = 0; n < 80; n++)
+	{
+		for(size_t repeat = 0; repeat < 25; repeat++)
+		{
+			std::vector<int32_t> a = std::vector<int32_t>(n);
+			std::vector<int32_t> b = std::vector<int32_t>(n);
+			
+			for(size_t k = 0; k < n; k++)
+			{
+				seed = seed * 1103515245 + 12345;
+				int32_t r = (int32_t)((seed >> 16) % 12);
+				
+				a[k] = (r == 0) ? FixedPointEnergy::infinity() : r * -1;
+				b[k] = (r == 1) ? FixedPointEnergy::infinity() : (r % 5) * -3;
+			}
+			
+			std::vector<int32_t> energies = {0, FixedPointEnergy::infinity(), -15};
+			for(std::vector<int32_t>::iterator initial = energies.begin(); initial != energies.end(); ++initial)
+			{
+				int32_t energy_reference = *initial;
+				size_t argmin_reference = 999;
+				bool found_reference = MinPlus::scalar(a.data(), b.data(), n, energy_reference, argmin_reference);
+				
+				for(std::vector<min_plus_kernel_int32>::iterator kernel = kernels.begin(); kernel != kernels.end(); ++kernel)
+				{
+					int32_t energy = *initial;
+					size_t argmin = 999;
+					bool found = (*kernel)(a.data(), b.data(), n, energy, argmin);
+					
+					BOOST_REQUIRE_EQUAL(found, found_reference);
+					BOOST_REQUIRE_EQUAL(argmin, argmin_reference);
+					BOOST_REQUIRE_EQUAL(energy, energy_reference);
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,114 @@
+/**
+ * @file test/PackedSequence_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#define BOOST_TEST_MODULE PackedSequence
+
+
+
+#include "main.hpp"
+
+#include "Nucleotide.hpp"
+#include "Position.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+#include "PackedSequence.hpp"
+
+#include <boost/test/included/unit_test.hpp>
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+/**
+ * @brief Tests whether all nucleotides are unpacked correctly, also across word boundaries
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test01)
+{
+	Sequence sequence = Sequence("ACGUUGCAAACCCGGGUUUAGCUAGCUAGCUAGGAUCCAUGGCAAU");
+	PackedSequence packed_sequence = PackedSequence(sequence);
+	
+	BOOST_CHECK_EQUAL(packed_sequence.size(), sequence.size());
+	
+	for(size_t i = 0; i < sequence.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(packed_sequence[i], sequence[i]);
+	}
+	
+	BOOST_CHECK(packed_sequence.subseq(3, 40) == sequence.subseq(3, 40));
+}
+
+
+
+/**
+ * @brief Tests whether the key of every window equals the key of the corresponding SubSequence
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test02)
+{
+	Sequence sequence = Sequence();
+	
+	srand(1);
+	for(size_t i = 0; i < 150; i++)
+	{
+		sequence.push_back((Nucleotide)(rand() % 4));
+	}
+	
+	PackedSequence packed_sequence = PackedSequence(sequence);
+	
+	for(size_t i = 0; i < sequence.size(); i++)
+	{
+		for(size_t size = 1; size <= SUBSEQUENCE_MAX_PACKED_SIZE && i + size <= sequence.size(); size++)
+		{
+			SubSequence subsequence = sequence.ssubseq(i, i + size - 1);
+			BOOST_CHECK_EQUAL(packed_sequence.key(i, size), subsequence.pack());
+		}
+	}
+}
+
+
+
+/**
+ * @brief Tests whether keys are distinct for distinct windows of the same size
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test03)
+{
+	Sequence sequence = Sequence("GAAACGAAAG");
+	PackedSequence packed_sequence = PackedSequence(sequence);
+	
+	BOOST_CHECK(packed_sequence.key(0, 5) != packed_sequence.key(5, 5));
+	BOOST_CHECK_EQUAL(packed_sequence.key(1, 3), packed_sequence.key(6, 3));
+	
+	BOOST_CHECK_EQUAL(packed_sequence.key(0, 1), (uint64_t) Nucleotide::G);
+	BOOST_CHECK_EQUAL(packed_sequence.key(0, 2), (uint64_t)((Nucleotide::G << 2) | Nucleotide::A));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
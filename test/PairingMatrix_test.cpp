@@ -0,0 +1,242 @@
+/**
+ * @file test/PairingMatrix_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#define BOOST_TEST_MODULE PairingMatrix
+
+
+
+#include "main.hpp"
+
+#include "Nucleotide.hpp"
+#include "Position.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+#include "PairingType.hpp"
+#include "Pairing.hpp"
+#include "PairingMatrix.hpp"
+
+#include <boost/test/included/unit_test.hpp>
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+/**
+ * @brief Tests whether every pair is classified as a Pairing would classify it
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test01)
+{
+	Sequence sequence = Sequence();
+	
+	srand(1);
+	for(size_t i = 0; i < 150; i++)
+	{
+		sequence.push_back((Nucleotide)(rand() % 4));
+	}
+	
+	PairingMatrix pairings = PairingMatrix(sequence);
+	BOOST_CHECK_EQUAL(pairings.size(), sequence.size());
+	
+	for(size_t i = 0; i < sequence.size(); i++)
+	{
+		for(size_t j = 0; j < sequence.size(); j++)
+		{
+			Pairing pairing = Pairing(sequence[i], sequence[j]);
+			
+			BOOST_CHECK_EQUAL(pairings.type(i, j), pairing.type);
+			BOOST_CHECK_EQUAL(pairings.is_canonical(i, j), (i != j && pairing.is_canonical()));
+		}
+	}
+}
+
+
+
+/**
+ * @brief Tests whether next() and previous() visit the same positions as a scan over all positions, also across word boundaries
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test02)
+{
+	Sequence sequence = Sequence();
+	
+	srand(2);
+	for(size_t i = 0; i < 200; i++)
+	{
+		sequence.push_back((Nucleotide)(rand() % 4));
+	}
+	
+	PairingMatrix pairings = PairingMatrix(sequence);
+	size_t n = sequence.size();
+	
+	for(size_t i = 0; i < n; i += 7)
+	{
+		for(size_t begin = 0; begin <= n; begin += 13)
+		{
+			for(size_t end = begin; end <= n; end += 11)
+			{
+				std::vector<size_t> expected;
+				for(size_t j = begin; j < end; j++)
+				{
+					if(pairings.is_canonical(i, j))
+					{
+						expected.push_back(j);
+					}
+				}
+				
+				std::vector<size_t> forward;
+				for(size_t j = begin; pairings.next(i, j, end); j++)
+				{
+					forward.push_back(j);
+				}
+				BOOST_CHECK(forward == expected);
+				
+				std::vector<size_t> backward;
+				for(size_t j = end; pairings.previous(i, j, begin);)
+				{
+					backward.push_back(j);
+				}
+				std::reverse(backward.begin(), backward.end());
+				BOOST_CHECK(backward == expected);
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Tests an explicit sequence, including the positions that pair with none
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test03)
+{
+	Sequence sequence = Sequence("GAAACUAAAC");
+	PairingMatrix pairings = PairingMatrix(sequence);
+	
+	BOOST_CHECK_EQUAL(pairings.type(0, 9), PairingType::GC);
+	BOOST_CHECK_EQUAL(pairings.type(9, 0), PairingType::CG);
+	BOOST_CHECK_EQUAL(pairings.type(0, 5), PairingType::GU);
+	BOOST_CHECK_EQUAL(pairings.type(1, 5), PairingType::AU);
+	BOOST_CHECK_EQUAL(pairings.type(1, 2), PairingType::None);
+	
+	size_t j = 0;
+	BOOST_CHECK(pairings.next(0, j, 10));
+	BOOST_CHECK_EQUAL(j, (size_t) 4);
+	j++;
+	BOOST_CHECK(pairings.next(0, j, 10));
+	BOOST_CHECK_EQUAL(j, (size_t) 5);
+	j++;
+	BOOST_CHECK(pairings.next(0, j, 10));
+	BOOST_CHECK_EQUAL(j, (size_t) 9);
+	j++;
+	BOOST_CHECK(!pairings.next(0, j, 10));
+	
+	j = 5;
+	BOOST_CHECK(pairings.previous(0, j, 0));
+	BOOST_CHECK_EQUAL(j, (size_t) 4);
+	BOOST_CHECK(!pairings.previous(0, j, 0));
+	
+	j = 10;
+	BOOST_CHECK(!pairings.previous(2, j, 6));
+}
+
+
+
+
+/**
+ * @brief Tests whether a maximal span only classifies the pairs within the span, and whether next() and previous() stay within it
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test04)
+{
+	Sequence sequence = Sequence();
+	
+	srand(4);
+	for(size_t i = 0; i < 300; i++)
+	{
+		sequence.push_back((Nucleotide)(rand() % 4));
+	}
+	
+	size_t n = sequence.size();
+	size_t spans[] = {1, 5, 63, 64, 65, 130, 299, 300};
+	
+	for(size_t s = 0; s < 8; s++)
+	{
+		PairingMatrix pairings = PairingMatrix(sequence, spans[s]);
+		
+		for(size_t i = 0; i < n; i++)
+		{
+			for(size_t j = 0; j < n; j++)
+			{
+				size_t span = (i > j) ? i - j : j - i;
+				Pairing pairing = Pairing(sequence[i], sequence[j]);
+				
+				BOOST_REQUIRE_EQUAL(pairings.is_canonical(i, j), (i != j && span <= spans[s] && pairing.is_canonical()));
+			}
+		}
+		
+		for(size_t i = 0; i < n; i += 17)
+		{
+			for(size_t begin = 0; begin <= n; begin += 29)
+			{
+				for(size_t end = begin; end <= n; end += 23)
+				{
+					std::vector<size_t> expected;
+					for(size_t j = begin; j < end; j++)
+					{
+						if(pairings.is_canonical(i, j))
+						{
+							expected.push_back(j);
+						}
+					}
+					
+					std::vector<size_t> forward;
+					for(size_t j = begin; pairings.next(i, j, end); j++)
+					{
+						forward.push_back(j);
+					}
+					BOOST_CHECK(forward == expected);
+					
+					std::vector<size_t> backward;
+					for(size_t j = end; pairings.previous(i, j, begin);)
+					{
+						backward.push_back(j);
+					}
+					std::reverse(backward.begin(), backward.end());
+					BOOST_CHECK(backward == expected);
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,175 @@
+/**
+ * @file test/ReadData_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#define BOOST_TEST_MODULE ReadData
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "Direction.hpp"
+#include "Nucleotide.hpp"
+#include "Position.hpp"
+#include "PairingPlus.hpp"
+
+#include "Sequence.hpp"
+
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+#include "ReadData.hpp"
+
+#include <boost/test/included/unit_test.hpp>
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+/**
+ * @brief Tests whether the compiled tables (ReadDataTables.hpp) are identical to the parameters of the load_*() functions; if not, run 'make tables'
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test1)
+{
+	ReadData compiled = ReadData();
+	ReadData loaded = ReadData();
+	loaded.load();
+	
+	BOOST_CHECK(memcmp(compiled.int11, loaded.int11, sizeof(loaded.int11)) == 0);
+	BOOST_CHECK(memcmp(compiled.int21, loaded.int21, sizeof(loaded.int21)) == 0);
+	BOOST_CHECK(memcmp(compiled.int22, loaded.int22, sizeof(loaded.int22)) == 0);
+	
+	BOOST_CHECK(memcmp(compiled.stack, loaded.stack, sizeof(loaded.stack)) == 0);
+	BOOST_CHECK(memcmp(compiled.tstackh, loaded.tstackh, sizeof(loaded.tstackh)) == 0);
+	BOOST_CHECK(memcmp(compiled.tstki, loaded.tstki, sizeof(loaded.tstki)) == 0);
+	
+	BOOST_CHECK(memcmp(compiled.miscloop, loaded.miscloop, sizeof(loaded.miscloop)) == 0);
+	
+	BOOST_CHECK(compiled.loop_hairpin == loaded.loop_hairpin);
+	BOOST_CHECK(compiled.loop_bulge == loaded.loop_bulge);
+	BOOST_CHECK(compiled.loop_interior == loaded.loop_interior);
+	BOOST_CHECK(compiled.poppen_p == loaded.poppen_p);
+	
+	BOOST_CHECK(compiled.tloop_map == loaded.tloop_map);
+	BOOST_CHECK(compiled.triloop_map == loaded.triloop_map);
+	
+	BOOST_CHECK_EQUAL(compiled.minimal_hairpin_length, loaded.minimal_hairpin_length);
+}
+
+
+
+/**
+ * @brief Tests whether instances do not share their parameters
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test2)
+{
+	ReadData thermodynamics_1 = ReadData();
+	thermodynamics_1.stack[PairingType::GC][PairingType::CG] = 100.0;
+	thermodynamics_1.loop_hairpin[3] = 100.0;
+	
+	ReadData thermodynamics_2 = ReadData();
+	BOOST_CHECK(thermodynamics_2.stack[PairingType::GC][PairingType::CG] != 100.0);
+	BOOST_CHECK(thermodynamics_2.loop_hairpin[3] != 100.0);
+}
+
+
+
+/**
+ * @brief Tests whether a binary parameter file restores all parameters (ReadData::save, ReadData::load)
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test3)
+{
+	char filename[] = "/tmp/readdata_testXXXXXX";
+	close(mkstemp(filename));
+	
+	ReadData thermodynamics_1 = ReadData();
+	thermodynamics_1.int22[PairingType::GC][PairingType::CG][Nucleotide::A][Nucleotide::C][Nucleotide::G][Nucleotide::U] = -12.5;
+	thermodynamics_1.loop_bulge[7] = 12.5;
+	thermodynamics_1.miscloop[MISCLOOP_PRELOG] = 1.5;
+	thermodynamics_1.triloop_map[Sequence("GAAAC")] = -3.0;
+	thermodynamics_1.minimal_hairpin_length = 4;
+	thermodynamics_1.save(std::string(filename));
+	
+	ReadData thermodynamics_2 = ReadData();
+	thermodynamics_2.loop_bulge.push_back(1.0);
+	thermodynamics_2.load(std::string(filename));
+	unlink(filename);
+	
+	BOOST_CHECK(memcmp(thermodynamics_1.int11, thermodynamics_2.int11, sizeof(thermodynamics_1.int11)) == 0);
+	BOOST_CHECK(memcmp(thermodynamics_1.int21, thermodynamics_2.int21, sizeof(thermodynamics_1.int21)) == 0);
+	BOOST_CHECK(memcmp(thermodynamics_1.int22, thermodynamics_2.int22, sizeof(thermodynamics_1.int22)) == 0);
+	BOOST_CHECK(memcmp(thermodynamics_1.stack, thermodynamics_2.stack, sizeof(thermodynamics_1.stack)) == 0);
+	BOOST_CHECK(memcmp(thermodynamics_1.tstackh, thermodynamics_2.tstackh, sizeof(thermodynamics_1.tstackh)) == 0);
+	BOOST_CHECK(memcmp(thermodynamics_1.tstki, thermodynamics_2.tstki, sizeof(thermodynamics_1.tstki)) == 0);
+	BOOST_CHECK(memcmp(thermodynamics_1.miscloop, thermodynamics_2.miscloop, sizeof(thermodynamics_1.miscloop)) == 0);
+	
+	BOOST_CHECK(thermodynamics_1.loop_hairpin == thermodynamics_2.loop_hairpin);
+	BOOST_CHECK(thermodynamics_1.loop_bulge == thermodynamics_2.loop_bulge);
+	BOOST_CHECK(thermodynamics_1.loop_interior == thermodynamics_2.loop_interior);
+	BOOST_CHECK(thermodynamics_1.poppen_p == thermodynamics_2.poppen_p);
+	
+	BOOST_CHECK(thermodynamics_1.tloop_map == thermodynamics_2.tloop_map);
+	BOOST_CHECK(thermodynamics_1.triloop_map == thermodynamics_2.triloop_map);
+	BOOST_CHECK_EQUAL(thermodynamics_2.triloop_map.size(), 1);
+	
+	BOOST_CHECK_EQUAL(thermodynamics_2.minimal_hairpin_length, 4);
+}
+
+
+
+/**
+ * @brief Tests whether files that are not a (complete) parameter file are rejected
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test4)
+{
+	char filename[] = "/tmp/readdata_testXXXXXX";
+	close(mkstemp(filename));
+	
+	ReadData thermodynamics = ReadData();
+	
+	BOOST_CHECK_THROW(thermodynamics.load(std::string("/dev/null/neverexist")), std::invalid_argument);
+	BOOST_CHECK_THROW(thermodynamics.load(std::string(filename)), std::invalid_argument);// empty
+	BOOST_CHECK_THROW(thermodynamics.load(std::string("share/segmentation-fold/segments.xml")), std::invalid_argument);// wrong magic
+	
+	thermodynamics.save(std::string(filename));
+	BOOST_CHECK_NO_THROW(thermodynamics.load(std::string(filename)));
+	
+	BOOST_CHECK_EQUAL(truncate(filename, (off_t) sizeof(readdata_file_header) + 1), 0);
+	BOOST_CHECK_THROW(thermodynamics.load(std::string(filename)), std::invalid_argument);// truncated
+	
+	unlink(filename);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,213 @@
+/**
+ * @file test/Scanner_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+#define BOOST_TEST_MODULE Scanner
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "Region.hpp"
+#include "Nucleotide.hpp"
+#include "Pairing.hpp"
+#include "PairingPlus.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+
+#include "Direction.hpp"
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+#include "ReadSegments.hpp"
+
+#include "ScoringMatrix.hpp"
+#include "Settings.hpp"
+#include "DotBracket.hpp"
+#include "ReadData.hpp"
+
+#include "Zuker.hpp"
+#include "Scanner.hpp"
+
+#include <random>
+
+
+
+#include <boost/test/included/unit_test.hpp>
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+
+
+/**
+ * @brief A sequence of hairpins and K-turns with random nucleotides in between
+ */
+Sequence scanner_test_sequence(size_t n)
+{
+	std::mt19937 generator = std::mt19937(3);
+	std::string nucleotides = "ACGU";
+	std::vector<std::string> motifs = {"GGGAAACCC", "guUGUGAUgaaacUGAac", "GCGCAAAAGCGC"};
+	
+	Sequence sequence = Sequence();
+	while(sequence.size() < n)
+	{
+		if(generator() % 8 == 0)
+		{
+			std::string &motif = motifs[generator() % motifs.size()];
+			for(size_t k = 0; k < motif.size() && sequence.size() < n; k++)
+			{
+				sequence.push_back(motif[k]);
+			}
+		}
+		else
+		{
+			sequence.push_back(nucleotides[generator() % 4]);
+		}
+	}
+	
+	return sequence;
+}
+
+
+
+/**
+ * @brief Compares every window on both strands with folding the window individually, across several chunks
+ *
+ * @section DESCRIPTION
+ * The windows are folded within chunks of a larger sequence, so the
+ * sums of their energies are calculated in a different order than in
+ * the individual folds and are compared after rounding.
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test1)
+{
+	size_t n = 731;
+	size_t window_size = 20;
+	size_t window_step = 10;
+	
+	Sequence sequence = scanner_test_sequence(n);
+	char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-w", (char *) "20", (char *) "-S", (char *) "10", nullptr};
+	signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+	Settings settings = Settings(argc, argv, sequence);
+	
+	ReadData thermodynamics = ReadData();
+	ReadSegments readsegments = ReadSegments(settings.segment_filename);
+	readsegments.parse(thermodynamics.segments, thermodynamics.segmentloops);
+	
+	sequence = scanner_test_sequence(n);
+	std::string name = "chr1 test sequence";
+	
+	std::stringstream output;
+	Scanner scanner = Scanner(settings, thermodynamics, output);
+	scanner.scan<Zuker>(name, sequence);
+	
+	settings.window_size = 0;
+	
+	std::string line;
+	size_t n_records = 0;
+	size_t n_windows = (n - window_size + window_step - 1) / window_step + 1;
+	
+	while(std::getline(output, line))
+	{
+		std::vector<std::string> fields;
+		std::stringstream line_stream(line);
+		std::string field;
+		while(std::getline(line_stream, field, '\t'))
+		{
+			fields.push_back(field);
+		}
+		BOOST_REQUIRE_EQUAL(fields.size(), 7);
+		
+		size_t start = std::stoul(fields[1]);
+		size_t end = std::stoul(fields[2]);
+		
+		BOOST_CHECK_EQUAL(fields[0], "chr1");
+		BOOST_CHECK_EQUAL(fields[5], (n_records < n_windows) ? "+" : "-");
+		BOOST_CHECK(end - start == window_size || (fields[5] == "+" ? end == n : start == 0));// only the last window of a strand is cut off
+		BOOST_CHECK_EQUAL(fields[6].size(), end - start);
+		
+		Sequence window = sequence.subseq(start, end - 1);
+		if(fields[5] == "-")
+		{
+			window = window.reverse_complement();
+		}
+		
+		Zuker zuker = Zuker(settings, window, thermodynamics);
+		
+		char individual_energy[16];
+		snprintf(individual_energy, sizeof(individual_energy), "%.2f", zuker.energy());
+		BOOST_CHECK_EQUAL(fields[3], std::string(individual_energy));
+		
+		n_records++;
+	}
+	
+	BOOST_CHECK_EQUAL(n_records, 2 * n_windows);
+}
+
+
+
+/**
+ * @brief Tests whether the structure column is left out in energy only mode, and whether windows can not be smaller than 2 nucleotides
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test2)
+{
+	Sequence sequence = Sequence();
+	char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-w", (char *) "15", (char *) "-e", (char *) "-p", (char *) "0", nullptr};
+	signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+	Settings settings = Settings(argc, argv, sequence);
+	
+	ReadData thermodynamics = ReadData();
+	
+	sequence = Sequence("GGGAAACCCAGGGAAACCCAGGGAAACCC");
+	std::string name = "";
+	
+	std::stringstream output;
+	Scanner scanner = Scanner(settings, thermodynamics, output);
+	scanner.scan<Zuker>(name, sequence);
+	
+	// Windows [0,15), [7,22), [14,29) on both strands; the energies are those of folding the windows individually
+	BOOST_CHECK_EQUAL(output.str(),
+					  "Sequence\t0\t15\t-2.00\t0\t+\n"
+					  "Sequence\t7\t22\t-4.20\t0\t+\n"
+					  "Sequence\t14\t29\t-2.00\t0\t+\n"
+					  "Sequence\t14\t29\t-2.40\t0\t-\n"
+					  "Sequence\t7\t22\t-5.30\t0\t-\n"
+					  "Sequence\t0\t15\t-2.40\t0\t-\n");
+	
+	settings.window_size = 1;
+	BOOST_CHECK_THROW(Scanner(settings, thermodynamics, output), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,242 @@
+/**
+ * @file test/Scheduler_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+#define BOOST_TEST_MODULE Scheduler
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "Region.hpp"
+#include "Nucleotide.hpp"
+#include "Pairing.hpp"
+#include "PairingPlus.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+
+#include "Direction.hpp"
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+#include "ReadSegments.hpp"
+
+#include "ScoringMatrix.hpp"
+#include "Settings.hpp"
+#include "DotBracket.hpp"
+#include "ReadData.hpp"
+
+#include "Zuker.hpp"
+#include "Scheduler.hpp"
+
+#include <fstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif //_OPENMP
+
+#include <boost/test/included/unit_test.hpp>
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+const std::vector<std::string> test_sequences =
+{
+	"GGGAAACCC",
+	"UUCCAGCUGAUGAGAGGAAACUCUGAUUGAAGCUGGAAAAACCUCCCAAAGCUGUGGA",
+	"AUGCUGAUGAUCGAUCGGCGCGAUAUAGCGCGAUUCGGAUCGAUCAUCAGCAU",
+	"CCGUGAUGAAAAAAUGACCGG",
+	"guUGUGAUgaaacUGAac",
+	"GCGCAAAAGCGCAAAAGCGCAAAAGCGCAAAAGCGCAAAAGCGCAAAAGCGCAAAAGCGCAAAAGCGCAAAAGCGCAAAA",
+	"ACGUACGUACGU"
+};
+
+
+
+/**
+ * @brief Folds several sequences concurrently and compares each of them with folding it individually
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test1)
+{
+	Sequence sequence = Sequence(test_sequences[0]);
+	char *argv[] = {(char *) PACKAGE_NAME, (char *) "-t", (char *) "4", nullptr};
+	signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+	Settings settings = Settings(argc, argv, sequence);
+	
+	ReadData thermodynamics = ReadData();
+	ReadSegments readsegments = ReadSegments(settings.segment_filename);
+	readsegments.parse(thermodynamics.segments, thermodynamics.segmentloops);
+	
+	std::vector<scheduler_job> jobs;
+	for(size_t i = 0; i < test_sequences.size(); i++)
+	{
+		jobs.push_back({"seq" + std::to_string(i), Sequence(test_sequences[i]), std::string()});
+	}
+	
+	Scheduler scheduler = Scheduler(settings, sequence, thermodynamics);
+	scheduler.fold(jobs);
+	
+	for(size_t i = 0; i < test_sequences.size(); i++)
+	{
+		Sequence individual_sequence = Sequence(test_sequences[i]);
+		settings.sequence_name = "seq" + std::to_string(i);
+		
+		Zuker zuker = Zuker(settings, individual_sequence, thermodynamics);
+		zuker.energy();
+		zuker.traceback();
+		
+		std::string individual_output = "";
+		zuker.format_2D_structure(individual_output);
+		
+		BOOST_CHECK_EQUAL(jobs[i].output, individual_output);
+	}
+}
+
+
+
+/**
+ * @brief Tests whether all records of a FASTA file are printed in input order, also across chunks
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test2)
+{
+	std::string filename = "tmp.scheduler_test_test2";
+	
+	std::ofstream myfile;
+	myfile.open(filename.c_str());
+	for(size_t i = 0; i < test_sequences.size(); i++)
+	{
+		myfile << ">r" << i << "\n" << test_sequences[i] << "\n";
+	}
+	myfile.close();
+	
+	Sequence sequence = Sequence();
+	char *argv[] = {(char *) PACKAGE_NAME, (char *) "-f", (char *) filename.c_str(), (char *) "-p", (char *) "0", nullptr};
+	signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+	Settings settings = Settings(argc, argv, sequence);
+	
+	ReadData thermodynamics = ReadData();
+	
+	Scheduler scheduler = Scheduler(settings, sequence, thermodynamics);
+	scheduler.chunk_size = 3;
+	
+	std::stringstream output;
+	std::streambuf *stdout_buffer = std::cout.rdbuf(output.rdbuf());
+	scheduler.run();
+	std::cout.rdbuf(stdout_buffer);
+	
+	std::string line;
+	size_t i = 0;
+	while(std::getline(output, line))
+	{
+		BOOST_REQUIRE(i < test_sequences.size());
+		BOOST_CHECK_EQUAL(line.substr(0, line.find(' ')), ">r" + std::to_string(i));
+		
+		std::getline(output, line);
+		BOOST_CHECK(Sequence(line) == Sequence(test_sequences[i]));
+		
+		std::getline(output, line);
+		BOOST_CHECK_EQUAL(line.size(), test_sequences[i].size());
+		
+		i++;
+	}
+	
+	BOOST_CHECK_EQUAL(i, test_sequences.size());
+	
+	unlink(filename.c_str());
+}
+
+
+
+/**
+ * @brief Stores the number of threads of a parallel region like the one in Zuker::energy() as output of the job
+ */
+void count_threads_job(Settings &job_settings, scheduler_job &job, ReadData &thermodynamics)
+{
+	int threads = 1;
+	
+	#pragma omp parallel num_threads(job_settings.num_threads)
+	{
+		#pragma omp single
+		{
+#ifdef _OPENMP
+			threads = omp_get_num_threads();
+#endif //_OPENMP
+		}
+	}
+	
+	job.output = std::to_string(threads);
+}
+
+
+
+/**
+ * @brief Tests whether a single job gets all threads and whether concurrent jobs get one thread each
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test3)
+{
+	Sequence sequence = Sequence(test_sequences[0]);
+	char *argv[] = {(char *) PACKAGE_NAME, (char *) "-t", (char *) "4", nullptr};
+	signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+	Settings settings = Settings(argc, argv, sequence);
+	
+	ReadData thermodynamics = ReadData();
+	Scheduler scheduler = Scheduler(settings, sequence, thermodynamics);
+	
+#ifdef _OPENMP
+	std::string expected_threads = "4";
+#else
+	std::string expected_threads = "1";
+#endif //_OPENMP
+	
+	std::vector<scheduler_job> jobs = {{"seq0", Sequence(test_sequences[1]), std::string()}};
+	scheduler.fold(jobs, &count_threads_job);
+	BOOST_CHECK_EQUAL(jobs[0].output, expected_threads);
+	
+	jobs.clear();
+	for(size_t i = 0; i < test_sequences.size(); i++)
+	{
+		jobs.push_back({"seq" + std::to_string(i), Sequence(test_sequences[i]), std::string()});
+	}
+	
+	scheduler.fold(jobs, &count_threads_job);
+	for(size_t i = 0; i < test_sequences.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(jobs[i].output, "1");
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -255,4 +255,447 @@ BOOST_AUTO_TEST_CASE(Test3)
 	}
 }
 
+
+
+
+/**
+ * @brief Tests whether row() and get_column() give the same elements as get()
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test4)
+{
+	for(size_t n = 2; n <= 40; n += 7)
+	{
+		ScoringMatrix<signed int> matrix = ScoringMatrix<signed int>(n, -1);
+		Pair pair;
+		signed int k = 0;
+		
+		for(pair.first = 0; pair.first < n; pair.first++)
+		{
+			for(pair.second = pair.first + 1; pair.second < n; pair.second++)
+			{
+				matrix.set(pair, k++);
+			}
+		}
+		
+		for(size_t i = 0; i + 1 < n; i++)
+		{
+			signed int *row = matrix.row(i);
+			
+			for(size_t j = i + 1; j < n; j++)
+			{
+				pair = Pair((unsigned int) i, (unsigned int) j);
+				BOOST_CHECK_EQUAL(row[j - i - 1], matrix.get(pair));
+			}
+		}
+		
+		std::vector<signed int> column = std::vector<signed int>(n + 1);
+		for(size_t j = 0; j < n; j++)
+		{
+			for(size_t i_begin = 0; i_begin <= j + 1; i_begin++)
+			{
+				matrix.get_column(j, i_begin, j + 1, column.data());
+				
+				for(size_t i = i_begin; i <= j; i++)
+				{
+					pair = Pair((unsigned int) i, (unsigned int) j);
+					BOOST_CHECK_EQUAL(column[i - i_begin], matrix.get(pair));
+				}
+			}
+		}
+	}
+}
+
+
+
+
+/**
+ * @brief Tests whether the column-major copy follows set() and fill(), including the diagonal
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test5)
+{
+	for(size_t n = 0; n <= 40; n += 8)
+	{
+		ScoringMatrix<float> matrix = ScoringMatrix<float>(n, 99.0f, true);
+		ScoringMatrix<float> reference = ScoringMatrix<float>(n, 99.0f);
+		
+		BOOST_CHECK(matrix.has_transposed_copy());
+		BOOST_CHECK(!reference.has_transposed_copy());
+		
+		matrix.fill(-1.0f);
+		reference.fill(-1.0f);
+		
+		Pair pair;
+		float k = 0.0f;
+		for(pair.first = 0; pair.first < n; pair.first++)
+		{
+			for(pair.second = pair.first + 1; pair.second < n; pair.second += 3)
+			{
+				matrix.set(pair, k);
+				reference.set(pair, k);
+				k += 0.5f;
+			}
+		}
+		
+		for(size_t j = 0; j < n; j++)
+		{
+			float *column = matrix.column(j);
+			
+			for(size_t i = 0; i <= j; i++)
+			{
+				pair = Pair((unsigned int) i, (unsigned int) j);
+				BOOST_CHECK_EQUAL(column[i], reference.get(pair));
+				BOOST_CHECK_EQUAL(matrix.get(pair), reference.get(pair));
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Tests whether the row and column spans give the same values as get(), including the padded diagonal
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test6)
+{
+	for(size_t n = 1; n <= 70; n += 23)
+	{
+		ScoringMatrix<float> matrix = ScoringMatrix<float>(n, 99.0f, true);
+		
+		Pair pair;
+		float k = 0.0f;
+		for(pair.first = 0; pair.first < n; pair.first++)
+		{
+			for(pair.second = pair.first + 1; pair.second < n; pair.second++)
+			{
+				matrix.set(pair, k);
+				k -= 0.25f;
+			}
+		}
+		
+		for(size_t i = 0; i + 1 < n; i++)
+		{
+			ScoringMatrixSpan<float> row = matrix.row_span(i);
+			BOOST_CHECK_EQUAL(row.length, n - i - 1);
+			
+			for(size_t j = i + 1; j < n; j++)
+			{
+				pair = Pair((unsigned int) i, (unsigned int) j);
+				BOOST_CHECK_EQUAL(row[j - i - 1], matrix.get(pair));
+			}
+		}
+		
+		for(size_t j = 0; j < n; j++)
+		{
+			ScoringMatrixSpan<float> column = matrix.column_span(j);
+			BOOST_CHECK_EQUAL(column.length, j + 1);
+			
+			for(size_t i = 0; i <= j; i++)
+			{
+				pair = Pair((unsigned int) i, (unsigned int) j);
+				BOOST_CHECK_EQUAL(column[i], matrix.get(pair));
+			}
+			
+#if DEBUG
+			BOOST_CHECK_THROW(column[j + 1], std::invalid_argument);
+#endif //DEBUG
+		}
+	}
+}
+
+
+
+
+/**
+ * @brief Tests the positions of the diagonal layout
+ *
+ * @test
+ *
+ * Positions:
+ *
+ * <PRE>
+	[-1 ][-1 ][-2 ][-2 ][-2 ]
+	[ 0 ][-1 ][-1 ][-2 ][-2 ]
+	[ 4 ][ 1 ][-1 ][-1 ][-2 ]
+	[ 7 ][ 5 ][ 2 ][-1 ][-1 ]
+	[ 9 ][ 8 ][ 6 ][ 3 ][-1 ]
+ * </PRE>
+ */
+BOOST_AUTO_TEST_CASE(Test7)
+{
+	ScoringMatrix<signed int, ScoringMatrixDiagonalLayout> matrix = ScoringMatrix<signed int, ScoringMatrixDiagonalLayout>(5, 0);
+	signed int expected[4][5] =
+	{
+		{-1, 0, 4, 7, 9},
+		{-1, -1, 1, 5, 8},
+		{-2, -1, -1, 2, 6},
+		{-2, -2, -1, -1, 3}
+	};
+	
+	BOOST_CHECK_EQUAL(matrix.size(), (size_t) 10);
+	
+	Pair p = Pair();
+	for(p.first = 0; p.first < 4; p.first++)
+	{
+		for(p.second = p.first; p.second < 5; p.second++)
+		{
+			BOOST_CHECK_EQUAL(expected[p.first][p.second], matrix.get_position(p));
+		}
+	}
+	
+	BOOST_CHECK_THROW(matrix.row(0), std::invalid_argument);
+	BOOST_CHECK_THROW(matrix.row_span(0), std::invalid_argument);
+}
+
+
+
+/**
+ * @brief Tests whether both layouts give identical results for set(), get(), fill(), get_column() and the column-major copy
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test8)
+{
+	for(size_t n = 0; n <= 45; n += 9)
+	{
+		ScoringMatrix<float> row_layout = ScoringMatrix<float>(n, 99.0f, true);
+		ScoringMatrix<float, ScoringMatrixDiagonalLayout> diagonal_layout = ScoringMatrix<float, ScoringMatrixDiagonalLayout>(n, 99.0f, true);
+		
+		BOOST_CHECK_EQUAL(row_layout.size(), diagonal_layout.size());
+		
+		row_layout.fill(-1.0f);
+		diagonal_layout.fill(-1.0f);
+		
+		Pair pair;
+		float k = 0.0f;
+		for(pair.first = 0; pair.first < n; pair.first++)
+		{
+			for(pair.second = pair.first + 1; pair.second < n; pair.second += 2)
+			{
+				row_layout.set(pair, k);
+				diagonal_layout.set(pair, k);
+				k += 0.5f;
+			}
+		}
+		
+		std::vector<float> column_1 = std::vector<float>(n + 1);
+		std::vector<float> column_2 = std::vector<float>(n + 1);
+		
+		for(size_t j = 0; j < n; j++)
+		{
+			for(size_t i = 0; i <= j; i++)
+			{
+				pair = Pair((unsigned int) i, (unsigned int) j);
+				BOOST_CHECK_EQUAL(row_layout.get(pair), diagonal_layout.get(pair));
+				BOOST_CHECK_EQUAL(row_layout.column_span(j)[i], diagonal_layout.column_span(j)[i]);
+			}
+			
+			for(size_t i_begin = 0; i_begin <= j + 1; i_begin += 3)
+			{
+				row_layout.get_column(j, i_begin, j + 1, column_1.data());
+				diagonal_layout.get_column(j, i_begin, j + 1, column_2.data());
+				
+				BOOST_CHECK(std::equal(column_1.begin(), column_1.begin() + (long)(j + 1 - i_begin), column_2.begin()));
+			}
+		}
+	}
+}
+
+
+
+
+/**
+ * @brief Tests the positions of a band of width 2 in the row layout
+ *
+ * @test
+ *
+ * <PRE>
+	[ - ][ 0 ][ 1 ][   ][   ]
+	[   ][ - ][ 2 ][ 3 ][   ]
+	[   ][   ][ - ][ 4 ][ 5 ]
+	[   ][   ][   ][ - ][ 6 ]
+ * </PRE>
+ */
+BOOST_AUTO_TEST_CASE(Test9)
+{
+	ScoringMatrix<signed int> matrix = ScoringMatrix<signed int>(5, 0, false, 2);
+	signed int expected[4][5] =
+	{
+		{-1, 0, 1, -1, -1},
+		{-1, -1, 2, 3, -1},
+		{-2, -1, -1, 4, 5},
+		{-2, -2, -1, -1, 6}
+	};
+	
+	BOOST_CHECK_EQUAL(matrix.size(), (size_t) 7);
+	BOOST_CHECK_EQUAL(matrix.get_max_span(), (size_t) 2);
+	
+	Pair p = Pair();
+	for(p.first = 0; p.first < 4; p.first++)
+	{
+		for(p.second = p.first; p.second < 5; p.second++)
+		{
+			BOOST_CHECK_EQUAL(expected[p.first][p.second], matrix.get_position(p));
+		}
+	}
+	
+	BOOST_CHECK_EQUAL(matrix.row_span(0).length, (size_t) 2);
+	BOOST_CHECK_EQUAL(matrix.row_span(3).length, (size_t) 1);
+	
+	// A band as wide as the matrix is the entire triangle
+	BOOST_CHECK_EQUAL(ScoringMatrix<signed int>(5, 0, false, 4).size(), (size_t) 10);
+	BOOST_CHECK_EQUAL(ScoringMatrix<signed int>(5, 0, false, 100).get_max_span(), (size_t) 4);
+	BOOST_CHECK_EQUAL(ScoringMatrix<signed int>(5, 0, false, 0).get_max_span(), (size_t) 4);
+}
+
+
+
+/**
+ * @brief Tests whether a band stores exactly the positions within the band, in both layouts and in the column-major copy
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test10)
+{
+	for(size_t n = 1; n <= 40; n += 3)
+	{
+		for(size_t w = 1; w <= n + 1; w += 2)
+		{
+			ScoringMatrix<float> row_layout = ScoringMatrix<float>(n, 99.0f, true, w);
+			ScoringMatrix<float, ScoringMatrixDiagonalLayout> diagonal_layout = ScoringMatrix<float, ScoringMatrixDiagonalLayout>(n, 99.0f, true, w);
+			
+			size_t w_effective = std::min(w, n - 1);
+			size_t n_elements = 0;
+			for(size_t i = 0; i < n; i++)
+			{
+				n_elements += std::min(n - i - 1, w_effective);
+			}
+			
+			BOOST_CHECK_EQUAL(row_layout.size(), n_elements);
+			BOOST_CHECK_EQUAL(diagonal_layout.size(), n_elements);
+			
+			row_layout.fill(-1.0f);
+			diagonal_layout.fill(-1.0f);
+			
+			Pair pair;
+			float k = 0.0f;
+			for(pair.first = 0; pair.first < n; pair.first++)
+			{
+				for(pair.second = pair.first + 1; pair.second < n && pair.second <= pair.first + w_effective; pair.second++)
+				{
+					row_layout.set(pair, k);
+					diagonal_layout.set(pair, k);
+					k += 1.0f;
+				}
+			}
+			
+			// Every position of the band is stored once
+			std::vector<float> sorted = std::vector<float>(n_elements);
+			std::copy(row_layout.row(0), row_layout.row(0) + n_elements, sorted.begin());
+			std::sort(sorted.begin(), sorted.end());
+			for(size_t e = 0; e < n_elements; e++)
+			{
+				BOOST_REQUIRE_EQUAL(sorted[e], (float) e);
+			}
+			
+			std::vector<float> column = std::vector<float>(n + 1);
+			
+			k = 0.0f;
+			for(pair.first = 0; pair.first < n; pair.first++)
+			{
+				ScoringMatrixSpan<float> row = row_layout.row_span(pair.first);
+				BOOST_CHECK_EQUAL(row.length, std::min(n - pair.first - 1, w_effective));
+				
+				for(pair.second = pair.first + 1; pair.second < n; pair.second++)
+				{
+					if(pair.second <= pair.first + w_effective)
+					{
+						BOOST_CHECK_EQUAL(row_layout.get(pair), k);
+						BOOST_CHECK_EQUAL(diagonal_layout.get(pair), k);
+						BOOST_CHECK_EQUAL(row[pair.second - pair.first - 1], k);
+						BOOST_CHECK_EQUAL(row_layout.column_span(pair.second)[pair.first], k);
+						BOOST_CHECK_EQUAL(diagonal_layout.column_span(pair.second)[pair.first], k);
+						k += 1.0f;
+					}
+					else
+					{
+						BOOST_CHECK_EQUAL(row_layout.get(pair), 99.0f);
+						BOOST_CHECK_EQUAL(diagonal_layout.get(pair), 99.0f);
+					}
+				}
+			}
+			
+			for(size_t j = 0; j < n; j++)
+			{
+				// The span of a column only holds the rows within the band
+				ScoringMatrixSpan<float> column_span = row_layout.column_span(j);
+				size_t first = (j > w_effective) ? j - w_effective : 0;
+				BOOST_CHECK_EQUAL(column_span.first, first);
+				BOOST_CHECK_EQUAL(column_span.length, j - first + 1);
+				BOOST_CHECK_EQUAL(column_span[j], 99.0f);
+				BOOST_CHECK_EQUAL(column_span.range(first, j - first + 1), &column_span[first]);
+#if DEBUG
+				if(first > 0)
+				{
+					BOOST_CHECK_THROW(column_span[first - 1], std::invalid_argument);
+					BOOST_CHECK_THROW(column_span.range(first - 1, 2), std::invalid_argument);
+				}
+				BOOST_CHECK_THROW(column_span.range(first, j - first + 2), std::invalid_argument);
+#endif //DEBUG
+				
+				
+				row_layout.get_column(j, 0, j + 1, column.data());
+				for(size_t i = 0; i <= j; i++)
+				{
+					pair = Pair((unsigned int) i, (unsigned int) j);
+					BOOST_CHECK_EQUAL(column[i], row_layout.get(pair));
+				}
+				
+				diagonal_layout.get_column(j, 0, j + 1, column.data());
+				for(size_t i = 0; i <= j; i++)
+				{
+					pair = Pair((unsigned int) i, (unsigned int) j);
+					BOOST_CHECK_EQUAL(column[i], row_layout.get(pair));
+				}
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Tests whether setting a position outside the band leaves the matrix unchanged
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test11)
+{
+	ScoringMatrix<float> matrix = ScoringMatrix<float>(6, 99.0f, true, 2);
+	matrix.fill(-1.0f);
+	
+	Pair pair = Pair(0, 3);
+#if DEBUG
+	BOOST_CHECK_THROW(matrix.set(pair, 1.0f), std::invalid_argument);
+#else //DEBUG
+	matrix.set(pair, 1.0f);
+#endif //DEBUG
+	
+	BOOST_CHECK_EQUAL(matrix.get(pair), 99.0f);
+	
+	for(pair.first = 0; pair.first < 6; pair.first++)
+	{
+		for(pair.second = pair.first + 1; pair.second < 6 && pair.second <= pair.first + 2; pair.second++)
+		{
+			BOOST_CHECK_EQUAL(matrix.get(pair), -1.0f);
+			BOOST_CHECK_EQUAL(matrix.column_span(pair.second)[pair.first], -1.0f);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
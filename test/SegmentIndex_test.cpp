@@ -0,0 +1,209 @@
+/**
+ * @file test/SegmentIndex_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * <PRE>
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * </PRE>
+ */
+
+
+
+#define BOOST_TEST_MODULE SegmentIndex
+
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+#include "Nucleotide.hpp"
+#include "Pairing.hpp"
+#include "SubSequence.hpp"
+#include "Sequence.hpp"
+
+#include "Direction.hpp"
+#include "Segment.hpp"
+#include "SegmentLoop.hpp"
+#include "SegmentTreeElement.hpp"
+#include "SegmentTree.hpp"
+#include "SegmentLoopTree.hpp"
+#include "SegmentIndex.hpp"
+
+#include "ReadSegments.hpp"
+
+
+
+#include <boost/test/included/unit_test.hpp>
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+
+
+/**
+ * @brief Tests whether a single segment is found at the right location
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test1)
+{
+	Sequence           rna              = Sequence("guUGUGAUgaaacUGAac");
+	std::vector <Pair> segment_01_bonds = {Pair({4, 1}), Pair({1, 1}), Pair({1, 1}) };
+	Segment            segment_01       = Segment("C/D-box K-turn", Sequence("UGUGAU"), segment_01_bonds, Sequence("UGA"), -100.0);
+	
+	SegmentTree segments = SegmentTree();
+	segments.insert(segment_01);
+	
+	SegmentIndex index = SegmentIndex(rna, segments);
+	BOOST_CHECK_EQUAL(index.size(), 1);
+	
+	std::vector<segment_candidate>::iterator begin, end;
+	
+	Pair p1 = Pair(1, 16);
+	index.search(p1, begin, end);
+	BOOST_REQUIRE(end - begin == 1);
+	BOOST_CHECK((begin->p2 == Pair(8, 12)));
+	BOOST_CHECK(begin->segment == &segment_01);
+	
+	Pair p1_other = Pair(1, 17);
+	index.search(p1_other, begin, end);
+	BOOST_CHECK(begin == end);
+}
+
+
+
+/**
+ * @brief Tests whether candidates wider than the maximum span are left out of the index
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test3)
+{
+	Sequence           rna              = Sequence("guUGUGAUgaaacUGAac");
+	std::vector <Pair> segment_01_bonds = {Pair({4, 1}), Pair({1, 1}), Pair({1, 1}) };
+	Segment            segment_01       = Segment("C/D-box K-turn", Sequence("UGUGAU"), segment_01_bonds, Sequence("UGA"), -100.0);
+	
+	SegmentTree segments = SegmentTree();
+	segments.insert(segment_01);
+	
+	// The only candidate is (1,16)
+	SegmentIndex index_15 = SegmentIndex(rna, segments, 15);
+	BOOST_CHECK_EQUAL(index_15.size(), 1);
+	
+	SegmentIndex index_14 = SegmentIndex(rna, segments, 14);
+	BOOST_CHECK_EQUAL(index_14.size(), 0);
+}
+
+
+
+/**
+ * @brief Compares the index with searching the SegmentTree for every (i,j,i',j') that is enclosed by canonical pairs
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test2)
+{
+	SegmentTree segments = SegmentTree();
+	SegmentLoopTree segmentloops = SegmentLoopTree();
+	
+	std::string filename = "share/segmentation-fold/segments.xml";
+	ReadSegments readsegments = ReadSegments(filename);
+	readsegments.parse(segments, segmentloops);
+	
+	std::vector<Segment *> all_segments;
+	segments.get_segments(all_segments);
+	BOOST_REQUIRE_EQUAL(all_segments.size(), segments.size());
+	
+	// Concatenation of hairpins with the first segments, enclosed by canonical pairs
+	Sequence rna = Sequence("GAUC");
+	for(size_t k = 0; k < std::min((size_t) 6, all_segments.size()); k++)
+	{
+		rna.push_back('C');
+		for(size_t l = 0; l < all_segments[k]->sequence_5p.size(); l++)
+		{
+			rna.push_back(all_segments[k]->sequence_5p[l]);
+		}
+		rna.push_back('G');
+		rna.push_back('A');
+		rna.push_back('A');
+		rna.push_back('A');
+		rna.push_back('A');
+		rna.push_back('C');
+		for(size_t l = 0; l < all_segments[k]->sequence_3p.size(); l++)
+		{
+			rna.push_back(all_segments[k]->sequence_3p[l]);
+		}
+		rna.push_back('G');
+		rna.push_back('U');
+	}
+	size_t n = rna.size();
+	
+	SegmentIndex index = SegmentIndex(rna, segments);
+	size_t found = 0;
+	
+	for(unsigned int i = 0; i < n; i++)
+	{
+		for(unsigned int j = i + 4; j < n; j++)
+		{
+			if(!Pairing(rna[i], rna[j]).is_canonical())
+			{
+				continue;
+			}
+			
+			Pair p1 = Pair(i, j);
+			std::vector<segment_candidate>::iterator candidate, end;
+			index.search(p1, candidate, end);
+			
+			for(unsigned int ip = i + 2; ip < j; ip++)
+			{
+				for(unsigned int jp = j - 2; jp > ip; jp--)
+				{
+					if(!Pairing(rna[ip], rna[jp]).is_canonical())
+					{
+						continue;
+					}
+					
+					SubSequence pp1 = rna.ssubseq(i + 1, ip - 1);
+					SubSequence pp2 = rna.ssubseq(jp + 1, j - 1);
+					Segment *segment = segments.search(pp1, pp2);
+					
+					if(segment != nullptr)
+					{
+						BOOST_REQUIRE(candidate != end);
+						BOOST_CHECK((candidate->p2 == Pair(ip, jp)));
+						BOOST_CHECK(candidate->segment == segment);
+						
+						++candidate;
+						found++;
+					}
+				}
+			}
+			
+			BOOST_CHECK(candidate == end);
+		}
+	}
+	
+	BOOST_CHECK_EQUAL(found, index.size());
+	BOOST_CHECK(found > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
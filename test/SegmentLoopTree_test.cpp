@@ -245,4 +245,74 @@ BOOST_AUTO_TEST_CASE(Test3)
 	BOOST_CHECK(segmentloop_tree_05.size() == 6);
 }
 
+
+/**
+ * @brief Tests whether spans of any length, including those too long to be packed, return exactly the matching SegmentLoop
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test4)
+{
+	std::vector <Pair> bonds = {{Pair({1, 1})}};
+	Sequence rna = Sequence();
+	
+	srand(1);
+	for(unsigned int i = 0; i < 200; i++)
+	{
+		rna.push_back((Nucleotide)(rand() % 4));
+	}
+	
+	// Loops are cut out of the RNA itself, so that the spans contain hits of every loaded length
+	std::vector<SegmentLoop> segmentloops;
+	segmentloops.reserve(40);// the tree keeps references, so the vector may not be re-allocated
+	for(size_t i = 0; i < 40; i++)
+	{
+		size_t start = (size_t) rand() % 150;
+		size_t size = (i % 10 == 0) ? 33 + i % 7 : 3 + (size_t) rand() % 6;
+		
+		bool duplicate = false;
+		for(std::vector<SegmentLoop>::iterator it = segmentloops.begin(); it != segmentloops.end(); ++it)
+		{
+			duplicate |= (it->sequence == rna.subseq(start, start + size - 1));
+		}
+		
+		if(!duplicate)
+		{
+			segmentloops.push_back(SegmentLoop("SegmentLoop", rna.subseq(start, start + size - 1), bonds, -1.0));
+		}
+	}
+	
+	SegmentLoopTree segmentloop_tree = SegmentLoopTree();
+	for(std::vector<SegmentLoop>::iterator it = segmentloops.begin(); it != segmentloops.end(); ++it)
+	{
+		segmentloop_tree.insert(*it);
+	}
+	BOOST_CHECK_EQUAL(segmentloop_tree.size(), segmentloops.size());
+	
+	for(size_t i = 0; i < rna.size(); i++)
+	{
+		for(size_t j = i; j < rna.size(); j++)
+		{
+			SubSequence span = rna.ssubseq(i, j);
+			
+			SegmentLoop *expected = nullptr;
+			for(std::vector<SegmentLoop>::iterator it = segmentloops.begin(); it != segmentloops.end(); ++it)
+			{
+				if(it->sequence == rna.subseq(i, j))
+				{
+					expected = &(*it);
+				}
+			}
+			
+			BOOST_CHECK(segmentloop_tree.search(span) == expected);
+		}
+	}
+	
+	segmentloop_tree.clear();
+	BOOST_CHECK(segmentloop_tree.empty());
+	
+	SubSequence span = rna.ssubseq(segmentloops[0].size(), segmentloops[0].size() * 2 - 1);
+	BOOST_CHECK(segmentloop_tree.search(span) == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,177 @@
+/**
+ * @file test/SegmentTracebackTable_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. if not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#define BOOST_TEST_MODULE SegmentTracebackTable
+
+#include <boost/test/included/unit_test.hpp>
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+
+#include "SegmentTraceback.hpp"
+#include "SegmentTracebackTable.hpp"
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+/**
+ * @brief Tests whether positions that were not set return nullptr and set positions return their SegmentTraceback
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test1)
+{
+	std::vector<Pair> bonds = {Pair(1, 1), Pair(2, 1)};
+	SegmentTraceback traceback_1 = SegmentTraceback(bonds);
+	SegmentTraceback traceback_2 = SegmentTraceback(bonds);
+	
+	SegmentTracebackTable table = SegmentTracebackTable();
+	Pair p1 = Pair(3, 19);
+	Pair p2 = Pair(19, 3);
+	Pair p3 = Pair(0, 0);
+	
+	BOOST_CHECK_EQUAL(table.size(), 0);
+	BOOST_CHECK(table.get(p1) == nullptr);
+	
+	table.set(p1, &traceback_1);
+	table.set(p3, &traceback_2);
+	
+	BOOST_CHECK_EQUAL(table.size(), 2);
+	BOOST_CHECK(table.get(p1) == &traceback_1);
+	BOOST_CHECK(table.get(p2) == nullptr);
+	BOOST_CHECK(table.get(p3) == &traceback_2);
+	
+	table.set(p1, &traceback_2);// overwrite
+	BOOST_CHECK_EQUAL(table.size(), 2);
+	BOOST_CHECK(table.get(p1) == &traceback_2);
+	
+	table.clear();
+	BOOST_CHECK_EQUAL(table.size(), 0);
+	BOOST_CHECK(table.get(p1) == nullptr);
+	BOOST_CHECK(table.get(p3) == nullptr);
+}
+
+
+
+/**
+ * @brief Tests whether the table grows correctly while being filled from multiple threads
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test2)
+{
+	std::vector<Pair> bonds = {Pair(1, 1)};
+	std::vector<SegmentTraceback> tracebacks(4, SegmentTraceback(bonds));
+	
+	SegmentTracebackTable table = SegmentTracebackTable();
+	signed int n = 200;
+	
+	#pragma omp parallel for num_threads(4)
+	for(signed int i = 0; i < n; i++)
+	{
+		for(signed int j = i + 1; j < n; j++)
+		{
+			if((i * 7 + j) % 5 == 0)
+			{
+				Pair p = Pair((unsigned int) i, (unsigned int) j);
+				table.set(p, &tracebacks[(size_t)(j % 4)]);
+			}
+		}
+	}
+	
+	size_t expected = 0;
+	for(signed int i = 0; i < n; i++)
+	{
+		for(signed int j = i + 1; j < n; j++)
+		{
+			Pair p = Pair((unsigned int) i, (unsigned int) j);
+			
+			if((i * 7 + j) % 5 == 0)
+			{
+				BOOST_REQUIRE(table.get(p) == &tracebacks[(size_t)(j % 4)]);
+				expected++;
+			}
+			else
+			{
+				BOOST_REQUIRE(table.get(p) == nullptr);
+			}
+		}
+	}
+	
+	BOOST_CHECK_EQUAL(table.size(), expected);
+}
+
+
+
+/**
+ * @brief Tests whether several tables can be filled concurrently and whether a copy is independent of its original
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test3)
+{
+	std::vector<Pair> bonds = {Pair(1, 1)};
+	SegmentTraceback traceback_1 = SegmentTraceback(bonds);
+	SegmentTraceback traceback_2 = SegmentTraceback(bonds);
+	
+	std::vector<SegmentTracebackTable> tables = std::vector<SegmentTracebackTable>(3);
+	signed int n = 100;
+	
+	#pragma omp parallel for num_threads(4) collapse(2)
+	for(signed int t = 0; t < 3; t++)
+	{
+		for(signed int i = 0; i < n; i++)
+		{
+			Pair p = Pair((unsigned int) i, (unsigned int)(i + t + 1));
+			tables[(size_t) t].set(p, &traceback_1);
+		}
+	}
+	
+	for(signed int t = 0; t < 3; t++)
+	{
+		BOOST_CHECK_EQUAL(tables[(size_t) t].size(), (size_t) n);
+		
+		for(signed int i = 0; i < n; i++)
+		{
+			Pair p = Pair((unsigned int) i, (unsigned int)(i + t + 1));
+			BOOST_REQUIRE(tables[(size_t) t].get(p) == &traceback_1);
+		}
+	}
+	
+	SegmentTracebackTable copy = tables[0];
+	Pair p = Pair(0, 1);
+	copy.set(p, &traceback_2);
+	
+	BOOST_CHECK(copy.get(p) == &traceback_2);
+	BOOST_CHECK(tables[0].get(p) == &traceback_1);
+	BOOST_CHECK_EQUAL(copy.size(), (size_t) n);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
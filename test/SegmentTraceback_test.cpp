@@ -174,4 +174,38 @@ BOOST_AUTO_TEST_CASE(Test_4)
 	BOOST_CHECK_EQUAL(j, 21);//23 - 1 - 2 - 0 - 1 - 2 - 0 = 21
 }
 
+
+
+/**
+ * @brief Tests whether a copy traces back independently from the original
+ *
+ * @test SegmentTraceback::SegmentTraceback(const SegmentTraceback &)
+ */
+BOOST_AUTO_TEST_CASE(Test_5)
+{
+	std::vector <Pair> bonds = {{Pair({1, 1}), Pair({1, 2}) }};
+	
+	unsigned int i = 12;
+	unsigned int j = 27;
+	
+	SegmentTraceback segmenttraceback = SegmentTraceback(bonds);
+	BOOST_CHECK(segmenttraceback.traceback(i, j));
+	
+	SegmentTraceback copy = segmenttraceback;					// starts at the first bond again
+	
+	unsigned int ci = 12;
+	unsigned int cj = 27;
+	
+	BOOST_CHECK(copy.traceback(ci, cj));
+	BOOST_CHECK(copy.traceback(ci, cj));
+	BOOST_CHECK(copy.traceback(ci, cj) == false);
+	BOOST_CHECK_EQUAL(ci, 14);
+	BOOST_CHECK_EQUAL(cj, 24);
+	
+	BOOST_CHECK(segmenttraceback.traceback(i, j));					// the original continues at its second bond
+	BOOST_CHECK_EQUAL(i, 14);
+	BOOST_CHECK_EQUAL(j, 24);
+	BOOST_CHECK(segmenttraceback.traceback(i, j) == false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
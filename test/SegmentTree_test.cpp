@@ -42,6 +42,7 @@
 #include "SegmentTree.hpp"
 
 #include <vector>
+#include <set>
 
 #include <boost/test/included/unit_test.hpp>
 
@@ -523,4 +524,122 @@ BOOST_AUTO_TEST_CASE(Test7)
 	BOOST_CHECK_THROW(segment_tree.insert(segment_fwd), std::invalid_argument);
 	BOOST_CHECK_THROW(segment_tree.insert(segment_rev), std::invalid_argument);
 }
+
+
+
+/**
+ * @brief Tests whether the length of the longest 5' and 3' sequences are tracked
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test8)
+{
+	SegmentTree segment_tree = SegmentTree();
+	
+	BOOST_CHECK_EQUAL(segment_tree.max_size(Direction::FivePrime), 0);
+	BOOST_CHECK_EQUAL(segment_tree.max_size(Direction::ThreePrime), 0);
+	
+	std::vector <Pair> bonds = {{ Pair({0, 2}), Pair({2, 1}), Pair({4, 0}) }};
+	
+	Segment segment_01 = Segment("Segment 1", Sequence("ACUUG"), bonds, Sequence("AUG"), -1.0);
+	Segment segment_02 = Segment("Segment 2", Sequence("ACU"), bonds, Sequence("AUGGUUA"), -1.0);
+	
+	segment_tree.insert(segment_01);
+	BOOST_CHECK_EQUAL(segment_tree.max_size(Direction::FivePrime), 5);
+	BOOST_CHECK_EQUAL(segment_tree.max_size(Direction::ThreePrime), 3);
+	
+	segment_tree.insert(segment_02);
+	BOOST_CHECK_EQUAL(segment_tree.max_size(Direction::FivePrime), 5);
+	BOOST_CHECK_EQUAL(segment_tree.max_size(Direction::ThreePrime), 7);
+}
+
+
+/**
+ * @brief Tests whether the flat table returns exactly the segment that matches the queried arms, also for arms too long to be packed
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test9)
+{
+	const char alphabet[] = "ACGU";
+	std::vector <Pair> bonds = {{ Pair({0, 0}) }};
+	
+	srand(1);
+	
+	std::set<std::pair<std::string, std::string> > arms;
+	while(arms.size() < 250)
+	{
+		std::string arm_5p = "";
+		std::string arm_3p = "";
+		size_t size_5p = (arms.size() % 25 == 0) ? (size_t)(33 + rand() % 8) : (size_t)(1 + rand() % 8);
+		size_t size_3p = (size_t)(1 + rand() % 8);
+		
+		for(size_t i = 0; i < size_5p; i++)
+		{
+			arm_5p.push_back(alphabet[rand() % 4]);
+		}
+		for(size_t i = 0; i < size_3p; i++)
+		{
+			arm_3p.push_back(alphabet[rand() % 4]);
+		}
+		
+		arms.insert({arm_5p, arm_3p});
+	}
+	
+	std::vector<Segment> segments;
+	segments.reserve(arms.size());// the tree keeps references, so the vector may not be re-allocated
+	
+	SegmentTree segment_tree = SegmentTree();
+	for(std::set<std::pair<std::string, std::string> >::iterator it = arms.begin(); it != arms.end(); ++it)
+	{
+		segments.push_back(Segment("Segment", Sequence(it->first), bonds, Sequence(it->second), -1.0));
+		segment_tree.insert(segments.back());
+	}
+	
+	BOOST_CHECK_EQUAL(segment_tree.size(), arms.size());
+	
+	// Each segment must be found as itself, mutated arms must give the matching segment or none
+	for(std::vector<Segment>::iterator it = segments.begin(); it != segments.end(); ++it)
+	{
+		Sequence query_5p = *it->get_sequence(Direction::FivePrime);
+		Sequence query_3p = *it->get_sequence(Direction::ThreePrime);
+		
+		for(unsigned int mutation = 0; mutation < 3; mutation++)
+		{
+			if(mutation == 1)
+			{
+				query_5p.data[0] = (Nucleotide)((query_5p.data[0] + 1) & 3);
+			}
+			else if(mutation == 2)
+			{
+				query_3p.data.pop_back();
+			}
+			
+			if(query_3p.size() == 0)
+			{
+				continue;
+			}
+			
+			Segment *expected = nullptr;
+			for(std::vector<Segment>::iterator it2 = segments.begin(); it2 != segments.end(); ++it2)
+			{
+				if(*it2->get_sequence(Direction::FivePrime) == query_5p && *it2->get_sequence(Direction::ThreePrime) == query_3p)
+				{
+					expected = &(*it2);
+				}
+			}
+			
+			SubSequence query_5p_ss = SubSequence(query_5p.data.begin(), query_5p.data.end() - 1);
+			SubSequence query_3p_ss = SubSequence(query_3p.data.begin(), query_3p.data.end() - 1);
+			
+			BOOST_CHECK(segment_tree.search(query_5p_ss, query_3p_ss) == expected);
+			
+			if(mutation == 0)
+			{
+				BOOST_CHECK(expected == &(*it));
+			}
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -433,4 +433,20 @@ BOOST_AUTO_TEST_CASE(Test10)
 	BOOST_REQUIRE_EQUAL(sequence.compare(larger_subsequence_05), IS_SMALLER);
 }
 
+
+
+/**
+ * @brief Tests Sequence::reverse_complement
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test11)
+{
+	Sequence sequence = Sequence("AACGUG");
+	
+	BOOST_CHECK(sequence.reverse_complement() == Sequence("CACGUU"));
+	BOOST_CHECK(sequence.reverse_complement().reverse_complement() == sequence);
+	BOOST_CHECK(Sequence("").reverse_complement().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -104,12 +104,10 @@ BOOST_AUTO_TEST_CASE(Test1)
 }
 
 /**
- * @brief Tests whether a FASTA file can be parsed correctly (-f)
+ * @brief Tests whether a FASTA file can be parsed correctly (-f), including its subsequent records
  *
  * @test
  *
- *
- * @todo Implement the possibility to run multiple entries from a FASTA file
  */
 BOOST_AUTO_TEST_CASE(Test2)
 {
@@ -153,6 +151,14 @@ BOOST_AUTO_TEST_CASE(Test2)
 	BOOST_CHECK_EQUAL(sequence[i++], Nucleotide::G);
 	
 	BOOST_CHECK(sequence == Sequence("ACTGactgACUGacug"));
+	BOOST_CHECK_EQUAL(settings.sequence_name, "some_sequence");
+	
+	BOOST_REQUIRE(settings.next_sequence());
+	BOOST_CHECK(sequence == Sequence("acgtgactgac"));
+	BOOST_CHECK_EQUAL(settings.sequence_name, "next seq");
+	
+	BOOST_CHECK(!settings.next_sequence());
+	BOOST_CHECK(sequence.empty());
 	
 	unlink(filename.c_str());
 }
@@ -453,4 +459,268 @@ BOOST_AUTO_TEST_CASE(Test10)
 	}
 }
 
+
+/**
+ * @brief Tests the multi-FASTA batch mode: empty records are skipped and -s overrules -f
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test11)
+{
+	std::string filename = "tmp.settings_test_test11";
+	
+	std::ofstream myfile;
+	myfile.open(filename.c_str());
+	myfile << ">a\r\nGGGAAACCC\r\n>empty\n\n>b\nAC\nGU\n>c\nUUUU";
+	myfile.close();
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-f", (char *) filename.c_str(), nullptr};
+		signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Sequence sequence;
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK(sequence == Sequence("GGGAAACCC"));
+		BOOST_CHECK_EQUAL(settings.sequence_name, "a");
+		
+		BOOST_REQUIRE(settings.next_sequence());
+		BOOST_CHECK(sequence == Sequence("ACGU"));
+		BOOST_CHECK_EQUAL(settings.sequence_name, "b");
+		
+		BOOST_REQUIRE(settings.next_sequence());
+		BOOST_CHECK(sequence == Sequence("UUUU"));
+		BOOST_CHECK_EQUAL(settings.sequence_name, "c");
+		
+		BOOST_CHECK(!settings.next_sequence());
+		BOOST_CHECK(!settings.next_sequence());
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-f", (char *) filename.c_str(), (char *) "-s", (char *) "acgu", nullptr};
+		signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Sequence sequence;
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK(sequence == Sequence("ACGU"));
+		BOOST_CHECK(settings.sequence_name.empty());
+		BOOST_CHECK(!settings.next_sequence());
+	}
+	
+	unlink(filename.c_str());
+}
+
+/**
+ * @brief Tests whether a binary parameter file can be selected (-P)
+ *
+ * @test
+ *
+ */
+BOOST_AUTO_TEST_CASE(Test12)
+{
+	Sequence sequence;
+	int argc;
+	
+	{
+		// Default: compiled parameters
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK(settings.parameter_filename.empty());
+	}
+	
+	{
+		// Check existing file
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-P", (char *) "share/segmentation-fold/" SEGMENTS_FILE, nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.parameter_filename, "share/segmentation-fold/" SEGMENTS_FILE);
+	}
+	
+	{
+		// Check non existing file
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-P", (char *) "/dev/null/neverexist", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		BOOST_CHECK_THROW(Settings settings = Settings(argc, argv, sequence), std::invalid_argument);
+	}
+}
+
+
+
+/**
+ * @brief Tests whether the energy only mode can be selected (-e)
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test13)
+{
+	Sequence sequence;
+	int argc;
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.energy_only, false);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-e", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.energy_only, true);
+		BOOST_CHECK_EQUAL(settings.proceed_with_folding, true);
+	}
+}
+
+
+
+/**
+ * @brief Tests whether traceback by recomputation can be selected (-r)
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test14)
+{
+	Sequence sequence;
+	int argc;
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.traceback_recomputation, false);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-r", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.traceback_recomputation, true);
+		BOOST_CHECK_EQUAL(settings.energy_only, false);
+	}
+}
+
+
+/**
+ * @brief Tests whether the maximum base pair span can be set (-L)
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test15)
+{
+	Sequence sequence;
+	int argc;
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.maximal_pair_span, 0);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-L", (char *) "150", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.maximal_pair_span, 150);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-L", (char *) "-5", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		BOOST_CHECK_THROW(Settings settings = Settings(argc, argv, sequence), std::invalid_argument);
+	}
+}
+
+
+/**
+ * @brief Tests whether the scanning windows can be set (-w and -S)
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test16)
+{
+	Sequence sequence;
+	int argc;
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.window_size, 0);
+		BOOST_CHECK_EQUAL(settings.window_step, 0);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-w", (char *) "200", (char *) "-S", (char *) "50", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.window_size, 200);
+		BOOST_CHECK_EQUAL(settings.window_step, 50);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-w", (char *) "2k", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		BOOST_CHECK_THROW(Settings settings = Settings(argc, argv, sequence), std::invalid_argument);
+	}
+	
+	// A window of one nucleotide can not hold a pair
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-w", (char *) "1", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		BOOST_CHECK_THROW(Settings settings = Settings(argc, argv, sequence), std::invalid_argument);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-w", (char *) "2", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		Settings settings = Settings(argc, argv, sequence);
+		
+		BOOST_CHECK_EQUAL(settings.window_size, 2);
+	}
+	
+	// -S without -w
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-S", (char *) "50", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		BOOST_CHECK_THROW(Settings settings = Settings(argc, argv, sequence), std::invalid_argument);
+	}
+	
+	{
+		char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-S", (char *) "5x", (char *) "-w", (char *) "20", nullptr};
+		argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+		
+		BOOST_CHECK_THROW(Settings settings = Settings(argc, argv, sequence), std::invalid_argument);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,204 @@
+/**
+ * @file test/TracebackMatrix_test.cpp
+ *
+ * @author Youri Hoogstrate
+ *
+ * @section LICENSE
+ * segmentation-fold can predict RNA 2D structures including K-turns.
+ * Copyright (C) 2012-2016 Youri Hoogstrate
+ *
+ * This file is part of segmentation-fold.
+ *
+ * segmentation-fold is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * segmentation-fold is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. if not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#define BOOST_TEST_MODULE TracebackMatrix
+
+#include <boost/test/included/unit_test.hpp>
+
+
+#include "main.hpp"
+
+#include "Pair.hpp"
+
+#include "ScoringMatrix.hpp"
+#include "ZukerTraceback.hpp"
+#include "TracebackMatrix.hpp"
+
+
+
+/**
+ * @brief Checks whether every kind of jump out of (i,j) is stored and decoded unchanged
+ *
+ * @param max_span Only checks the pairs with j - i <= max_span; 0 for all pairs
+ */
+void check_roundtrip(TracebackMatrix &matrix, unsigned int n, char arg_matrix, char arg_bifurcation_matrix, unsigned int max_span = 0)
+{
+	for(unsigned int i = 0; i < n; i++)
+	{
+		for(unsigned int j = i + 1; j < n && (max_span == 0 || j - i <= max_span); j++)
+		{
+			Pair p = Pair(i, j);
+			std::vector<traceback_jump> jumps = {{{UNBOUND, UNBOUND}, arg_matrix}, {p, V_MATRIX}};
+			
+			if(j - i >= 2)
+			{
+				jumps.push_back({{i + 1, i + 1}, arg_bifurcation_matrix});
+				jumps.push_back({{j - 1, j - 1}, arg_bifurcation_matrix});
+				
+				jumps.push_back({{i + 1, j}, arg_matrix});
+				jumps.push_back({{i, j - 1}, arg_matrix});
+				jumps.push_back({{j - 1, j}, arg_matrix});
+				jumps.push_back({{i, i + 1}, arg_matrix});
+			}
+			
+			if(j - i >= 3)
+			{
+				jumps.push_back({{i + 1, j - 1}, arg_matrix});
+			}
+			
+			for(std::vector<traceback_jump>::iterator it = jumps.begin(); it != jumps.end(); ++it)
+			{
+				matrix.set(p, *it);
+				traceback_jump jump = matrix.get(p);
+				
+				BOOST_CHECK_EQUAL(jump.target.first, it->target.first);
+				BOOST_CHECK_EQUAL(jump.target.second, it->target.second);
+				BOOST_CHECK_EQUAL(jump.target_matrix, it->target_matrix);
+			}
+		}
+	}
+}
+
+
+
+BOOST_AUTO_TEST_SUITE(Testing)
+
+/**
+ * @brief Tests whether short sequences use 2 bytes per element and longer sequences 4 bytes
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test1)
+{
+	for(size_t n = 0; n <= 300; n++)
+	{
+		TracebackMatrix matrix = TracebackMatrix(n, V_MATRIX, WM_MATRIX);
+		ScoringMatrix<char> reference = ScoringMatrix<char>(n, 0);
+		
+		BOOST_CHECK_EQUAL(matrix.size(), reference.size());
+		BOOST_CHECK_EQUAL(matrix.bytes_per_element(), (n <= TRACEBACKMATRIX_NARROW_MAX_SIZE) ? 2 : 4);
+	}
+}
+
+
+
+/**
+ * @brief Tests whether all jumps are stored and restored correctly, using both 2 and 4 byte elements
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test2)
+{
+	{
+		TracebackMatrix matrix = TracebackMatrix(TRACEBACKMATRIX_NARROW_MAX_SIZE, V_MATRIX, WM_MATRIX);
+		BOOST_REQUIRE_EQUAL(matrix.bytes_per_element(), 2);
+		check_roundtrip(matrix, TRACEBACKMATRIX_NARROW_MAX_SIZE, V_MATRIX, WM_MATRIX);
+	}
+	
+	{
+		TracebackMatrix matrix = TracebackMatrix(TRACEBACKMATRIX_NARROW_MAX_SIZE + 30, W_MATRIX, W_MATRIX);
+		BOOST_REQUIRE_EQUAL(matrix.bytes_per_element(), 4);
+		check_roundtrip(matrix, TRACEBACKMATRIX_NARROW_MAX_SIZE + 30, W_MATRIX, W_MATRIX);
+	}
+}
+
+
+
+/**
+ * @brief Tests the default (UNBOUND) and NOT_YET_CALCULATED elements and the diagonals
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test3)
+{
+	size_t sizes[] = {10, TRACEBACKMATRIX_NARROW_MAX_SIZE + 1};
+	
+	for(size_t k = 0; k < 2; k++)
+	{
+		TracebackMatrix matrix = TracebackMatrix(sizes[k], WM_MATRIX, WM_MATRIX);
+		Pair p = Pair(2, 7);
+		Pair diagonal = Pair(3, 3);
+		
+		BOOST_CHECK_EQUAL(matrix.get(p).target.first, (unsigned int) UNBOUND);
+		BOOST_CHECK_EQUAL(matrix.get(p).target_matrix, WM_MATRIX);
+		BOOST_CHECK_EQUAL(matrix.get(diagonal).target.first, (unsigned int) UNBOUND);
+		
+		matrix.fill({{NOT_YET_CALCULATED, NOT_YET_CALCULATED}, WM_MATRIX});
+		BOOST_CHECK_EQUAL(matrix.get(p).target.first, (unsigned int) NOT_YET_CALCULATED);
+		BOOST_CHECK_EQUAL(matrix.get(p).target.second, (unsigned int) NOT_YET_CALCULATED);
+		BOOST_CHECK_EQUAL(matrix.get(diagonal).target.first, (unsigned int) UNBOUND);
+		
+		matrix.set(p, {{4, 4}, WM_MATRIX});
+		BOOST_CHECK_EQUAL(matrix.get(p).target.first, 4);
+		BOOST_CHECK_EQUAL(matrix.get(p).target.second, 4);
+	}
+	
+#if DEBUG
+	TracebackMatrix matrix = TracebackMatrix(10, V_MATRIX, WM_MATRIX);
+	Pair p = Pair(2, 7);
+	BOOST_CHECK_THROW(matrix.set(p, {{4, 4}, V_MATRIX}), std::invalid_argument);// bifurcation into the wrong matrix
+	BOOST_CHECK_THROW(matrix.set(p, {{3, 8}, V_MATRIX}), std::invalid_argument);// outside (i,j)
+#endif //DEBUG
+}
+
+
+
+
+/**
+ * @brief Tests whether a band of pairs only stores the band, and whether its element width depends on the span
+ *
+ * @test
+ */
+BOOST_AUTO_TEST_CASE(Test4)
+{
+	{
+		TracebackMatrix matrix = TracebackMatrix(1000, V_MATRIX, WM_MATRIX, TRACEBACKMATRIX_NARROW_MAX_SIZE - 1);
+		ScoringMatrix<char> reference = ScoringMatrix<char>(1000, 0, false, TRACEBACKMATRIX_NARROW_MAX_SIZE - 1);
+		
+		BOOST_CHECK_EQUAL(matrix.size(), reference.size());
+		BOOST_REQUIRE_EQUAL(matrix.bytes_per_element(), 2);
+		check_roundtrip(matrix, 1000, V_MATRIX, WM_MATRIX, TRACEBACKMATRIX_NARROW_MAX_SIZE - 1);
+	}
+	
+	{
+		TracebackMatrix matrix = TracebackMatrix(1000, WM_MATRIX, WM_MATRIX, TRACEBACKMATRIX_NARROW_MAX_SIZE);
+		BOOST_REQUIRE_EQUAL(matrix.bytes_per_element(), 4);
+		check_roundtrip(matrix, 1000, WM_MATRIX, WM_MATRIX, TRACEBACKMATRIX_NARROW_MAX_SIZE);
+	}
+	
+	// Sequences longer than TRACEBACKMATRIX_WIDE_MAX_SIZE only fit within a band
+	BOOST_CHECK_THROW(TracebackMatrix(TRACEBACKMATRIX_WIDE_MAX_SIZE + 1, V_MATRIX, WM_MATRIX), std::invalid_argument);
+	
+	TracebackMatrix matrix = TracebackMatrix(TRACEBACKMATRIX_WIDE_MAX_SIZE + 1, V_MATRIX, WM_MATRIX, 100);
+	Pair p = Pair(TRACEBACKMATRIX_WIDE_MAX_SIZE - 100, TRACEBACKMATRIX_WIDE_MAX_SIZE);
+	matrix.set(p, {{p.first + 3, p.second - 2}, V_MATRIX});
+	BOOST_CHECK_EQUAL(matrix.get(p).target.first, p.first + 3);
+	BOOST_CHECK_EQUAL(matrix.get(p).target.second, p.second - 2);
+	BOOST_CHECK_EQUAL(matrix.bytes_per_element(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -46,6 +46,7 @@
 #include "SegmentTreeElement.hpp"
 #include "SegmentTree.hpp"
 #include "SegmentLoopTree.hpp"
+#include "ReadSegments.hpp"
 
 #include "ScoringMatrix.hpp"
 #include "Settings.hpp"
@@ -54,6 +55,8 @@
 
 #include "Zuker.hpp"
 
+#include <functional>
+
 #include <boost/test/included/unit_test.hpp>
 
 
@@ -585,6 +588,425 @@ BOOST_AUTO_TEST_CASE(Test_energy_bifuraction)
 	BOOST_CHECK_EQUAL(energy, -45.0f);
 }
 
+
+
+#define COMPARE_ENERGY             1
+#define COMPARE_ENERGY_MATRICES    2
+#define COMPARE_TRACEBACK_MATRICES 4
+#define COMPARE_STRUCTURES         8
+
+
+
+/**
+ * @brief Sequences of the tests that compare a variant of the engine with a reference; the last ones fold into one and two K-turns with the default segments
+ */
+const std::vector<std::string> comparison_sequences =
+{
+	"UUCCAGCUGAUGAGAGGAAACUCUGAUUGAAGCUGGAAAAACCUCCCAAAGCUGUGGA",
+	"AUGCUGAUGAUCGAUCGGCGCGAUAUAGCGCGAUUCGGAUCGAUCAUCAGCAUGGGAAACCCUUUGGGCCCAAAGCUAGCUAGCUAGGCUAGCAUCGAUCAG",
+	"GCCGGCAAAGGCCGGAAACCGGCCAAGCGCAAAAGCGCAACCCGGGAAACCCGGGAAAGCCGGC",
+	"GGGAAACCC",
+	"AAAA",
+	"guUGUGAUgaaacUGAac",
+	"guUGUGAUgaaacUGAacGGGAAACCCguUGUGAUgaaacUGAac"
+};
+
+char *comparison_argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", nullptr};
+
+
+
+/**
+ * @brief Default settings, parameters and segments of the tests that compare a variant of the engine with a reference
+ */
+struct comparison_setup
+{
+	Sequence sequence;
+	Settings settings;
+	ReadData thermodynamics;
+	ReadSegments readsegments;
+	
+	comparison_setup(void) :
+		sequence(),
+		settings(3, comparison_argv, sequence),
+		thermodynamics(),
+		readsegments(settings.segment_filename)
+	{
+		this->readsegments.parse(this->thermodynamics.segments, this->thermodynamics.segmentloops);
+	}
+};
+
+
+
+/**
+ * @brief Additional check of a variant against its reference; a nested type, so that it does not take part in template argument deduction
+ */
+template <class Variant, class Reference>
+struct comparison_check
+{
+	typedef std::function<void(Variant &, Reference &, Sequence &)> type;
+};
+
+
+
+/**
+ * @brief Folds every comparison sequence with the reference and the variant and compares them
+ *
+ * @section DESCRIPTION
+ * The energy matrices are compared cell by cell and the structures after
+ * a traceback of both. The energy is compared with energy(0, n), which
+ * only reads the filled matrices. The optional check is called for the
+ * variant after it was filled and before its traceback.
+ *
+ * @param reference_settings Settings of the reference engine
+ * @param variant_settings Settings of the variant engine
+ * @param thermodynamics Parameters and segments of both
+ * @param comparisons COMPARE_ENERGY, COMPARE_ENERGY_MATRICES, COMPARE_TRACEBACK_MATRICES and/or COMPARE_STRUCTURES
+ * @param check Additional checks of the variant
+ */
+template <class Variant, class Reference = Zuker>
+void compare_with_reference(Settings &reference_settings, Settings &variant_settings, ReadData &thermodynamics, unsigned int comparisons, typename comparison_check<Variant, Reference>::type check = nullptr)
+{
+	for(std::vector<std::string>::const_iterator it = comparison_sequences.begin(); it != comparison_sequences.end(); ++it)
+	{
+		BOOST_TEST_CHECKPOINT(*it);
+		
+		Sequence sequence = Sequence(*it);
+		unsigned int n = (unsigned int) sequence.size();
+		
+		Reference reference = Reference(reference_settings, sequence, thermodynamics);
+		reference.energy();
+		
+		Variant zuker = Variant(variant_settings, sequence, thermodynamics);
+		zuker.energy();
+		
+		if(comparisons & COMPARE_ENERGY)
+		{
+			BOOST_CHECK_EQUAL(zuker.energy(0, n), reference.energy(0, n));
+		}
+		
+		for(unsigned int i = 0; i < n && (comparisons & (COMPARE_ENERGY_MATRICES | COMPARE_TRACEBACK_MATRICES)); i++)
+		{
+			for(unsigned int j = i + 1; j < n; j++)
+			{
+				Pair p = Pair(i, j);
+				
+				if(comparisons & COMPARE_ENERGY_MATRICES)
+				{
+					BOOST_REQUIRE_EQUAL(zuker.vij.get(p), reference.vij.get(p));
+					BOOST_REQUIRE_EQUAL(zuker.wij.get(p), reference.wij.get(p));
+					BOOST_REQUIRE_EQUAL(zuker.wmij.get(p), reference.wmij.get(p));
+				}
+				
+				if(comparisons & COMPARE_TRACEBACK_MATRICES)
+				{
+					BOOST_REQUIRE(zuker.tij_v.get(p).target == reference.tij_v.get(p).target);
+					BOOST_REQUIRE(zuker.tij_w.get(p).target == reference.tij_w.get(p).target);
+					BOOST_REQUIRE(zuker.tij_wm.get(p).target == reference.tij_wm.get(p).target);
+					BOOST_REQUIRE(zuker.sij.get(p) == reference.sij.get(p));
+				}
+			}
+		}
+		
+		if(check)
+		{
+			check(zuker, reference, sequence);
+		}
+		
+		if(comparisons & COMPARE_STRUCTURES)
+		{
+			reference.traceback();
+			zuker.traceback();
+			
+			std::string dotbracket_reference;
+			std::string dotbracket;
+			reference.dot_bracket.format(n, dotbracket_reference);
+			zuker.dot_bracket.format(n, dotbracket);
+			
+			BOOST_CHECK_EQUAL(dotbracket, dotbracket_reference);
+			BOOST_CHECK_EQUAL(zuker.get_folded_segments(), reference.get_folded_segments());
+		}
+	}
+}
+
+
+
+/**
+ * @brief Tests whether filling the matrices in tiles gives exactly the same matrices and structure as filling them per diagonal (tile size 1)
+ *
+ * @test
+ */
+BOOST_FIXTURE_TEST_CASE(Test_tiled_fill, comparison_setup)
+{
+	std::vector<unsigned int> tile_sizes = {2, 3, 7, 16, 64, 1000};
+	
+	Settings reference_settings = settings;
+	reference_settings.tile_size = 1;
+	
+	for(std::vector<unsigned int>::iterator tile_size = tile_sizes.begin(); tile_size != tile_sizes.end(); ++tile_size)
+	{
+		settings.tile_size = *tile_size;
+		compare_with_reference<Zuker>(reference_settings, settings, thermodynamics, COMPARE_ENERGY_MATRICES | COMPARE_TRACEBACK_MATRICES | COMPARE_STRUCTURES);
+	}
+}
+
+
+
+/**
+ * @brief Tests whether the maximal loop length (-l) limits bulge and interior loops, but not segments
+ *
+ * @test
+ */
+BOOST_FIXTURE_TEST_CASE(Test_maximal_loop_length, comparison_setup)
+{
+	char *argv[] = {(char *) PACKAGE_NAME, (char *) "-s", (char *) "a", (char *) "-l", (char *) "3", nullptr};
+	signed int argc = (signed int) sizeof(argv) / (signed int) sizeof(char *) - 1;
+	Settings limited_settings = Settings(argc, argv, sequence);
+	
+	BOOST_REQUIRE_EQUAL(limited_settings.maximal_loop_length, 3);
+	
+	// A limit larger than any loop is no limit
+	Settings limited_large_settings = settings;
+	limited_large_settings.maximal_loop_length = 1000000;
+	compare_with_reference<Zuker>(settings, limited_large_settings, thermodynamics, COMPARE_ENERGY | COMPARE_ENERGY_MATRICES | COMPARE_STRUCTURES);
+	
+	compare_with_reference<Zuker>(settings, limited_settings, thermodynamics, 0, [](Zuker & limited, Zuker & unlimited, Sequence & rna)
+	{
+		unsigned int n = (unsigned int) rna.size();
+		BOOST_CHECK(limited.energy(0, n) >= unlimited.energy(0, n));
+		
+		for(unsigned int i = 0; i < n; i++)
+		{
+			for(unsigned int j = i + 1; j < n; j++)
+			{
+				Pair p = Pair(i, j);
+				traceback_jump jump = limited.tij_v.get(p);
+				
+				if(limited.vij.get(p) < N_INFINITY && jump.target_matrix == V_MATRIX && jump.target.first != (unsigned int) UNBOUND && limited.sij.get(p) == nullptr)
+				{
+					BOOST_CHECK_LE((jump.target.first - i - 1) + (j - jump.target.second - 1), 3);
+				}
+			}
+		}
+	});
+	
+	// Segments are not affected by the maximal loop length: see Test1
+	Sequence rna_1 = Sequence("guUGUGAUgaaacUGAac");
+	Pairing pairing = Pairing(rna_1[8], rna_1[12]);
+	
+	std::string        segment_01_name  = "C/D-box K-turn";
+	Sequence           segment_01_seq5p = Sequence("UGUGAU");
+	std::vector <Pair> segment_01_bonds = {Pair({4, 1}), Pair({1, 1}), Pair({1, 1}) };
+	Sequence           segment_01_seq3p = Sequence("UGA");
+	Segment            segment_01       = Segment(segment_01_name, segment_01_seq5p, segment_01_bonds, segment_01_seq3p, -100.0);
+	
+	ReadData thermodynamics_kturn = ReadData();
+	thermodynamics_kturn.tstackh[pairing.type][rna_1[9]][rna_1[11]] = -21.0;
+	thermodynamics_kturn.triloop_map.clear();
+	thermodynamics_kturn.triloop_map[Sequence("gaaac")] = -21.0;
+	thermodynamics_kturn.loop_hairpin[3] = 0;
+	thermodynamics_kturn.stack[PairingType::GC][PairingType::UA] = -30.0;
+	thermodynamics_kturn.stack[PairingType::UA][PairingType::UA] = -40.0;
+	thermodynamics_kturn.segments.insert(segment_01);
+	
+	limited_settings.maximal_loop_length = 1;
+	
+	Zuker zuker = Zuker(limited_settings, rna_1, thermodynamics_kturn);
+	BOOST_CHECK_EQUAL(zuker.energy(), (float) - 100.0 + -21.0 + -21.0 + -30.0 + -1.50);
+	
+	zuker.traceback();
+	std::string dotbracket;
+	zuker.dot_bracket.format((unsigned int) rna_1.size(), dotbracket);
+	BOOST_CHECK_EQUAL(dotbracket, "((...((((...))))))");
+}
+
+
+
+
+/**
+ * @brief Tests whether the energy only mode (-e) gives exactly the same energy matrices without filling the traceback matrices
+ *
+ * @test
+ */
+BOOST_FIXTURE_TEST_CASE(Test_energy_only, comparison_setup)
+{
+	Settings energy_only_settings = settings;
+	energy_only_settings.energy_only = true;
+	
+	compare_with_reference<Zuker>(settings, energy_only_settings, thermodynamics, COMPARE_ENERGY | COMPARE_ENERGY_MATRICES, [](Zuker & zuker, Zuker & reference, Sequence & rna)
+	{
+		BOOST_CHECK_EQUAL(zuker.tij_v.size(), 0);
+		BOOST_CHECK_EQUAL(zuker.tij_w.size(), 0);
+		BOOST_CHECK_EQUAL(zuker.tij_wm.size(), 0);
+		BOOST_CHECK_EQUAL(zuker.sij.size(), 0);
+		
+		BOOST_CHECK_THROW(zuker.traceback(), std::invalid_argument);
+		
+		char header[128];
+		snprintf(header, sizeof(header), ">Sequence length: %zubp, dE: %.2f kcal/mole\n", rna.size(), reference.energy(0, rna.size()));
+		
+		std::string output;
+		zuker.format_2D_structure(output);
+		BOOST_CHECK_EQUAL(output, std::string(header) + rna.str() + "\n");
+	});
+}
+
+
+
+/**
+ * @brief Tests whether the traceback by recomputation (-r) gives exactly the same structures as the traceback matrices
+ *
+ * @test
+ */
+BOOST_FIXTURE_TEST_CASE(Test_traceback_recomputation, comparison_setup)
+{
+	Settings recomputation_settings = settings;
+	recomputation_settings.traceback_recomputation = true;
+	
+	compare_with_reference<Zuker>(settings, recomputation_settings, thermodynamics, COMPARE_ENERGY | COMPARE_ENERGY_MATRICES | COMPARE_STRUCTURES, [](Zuker & zuker, Zuker &, Sequence &)
+	{
+		BOOST_CHECK_EQUAL(zuker.tij_v.size(), 0);
+		BOOST_CHECK_EQUAL(zuker.tij_w.size(), 0);
+		BOOST_CHECK_EQUAL(zuker.tij_wm.size(), 0);
+		BOOST_CHECK_EQUAL(zuker.sij.size(), 0);
+	});
+}
+
+
+/**
+ * @brief Tests whether the fixed-point engine (dcal/mol in int32) predicts the same structures as the float engine
+ *
+ * @section DESCRIPTION
+ * The parameters have a precision of 0.1 kcal/mol, so only the
+ * extrapolated loop energies are rounded and the energies may only
+ * differ by a few dcal/mol.
+ *
+ * @test
+ */
+BOOST_FIXTURE_TEST_CASE(Test_fixed_point_energy, comparison_setup)
+{
+	BOOST_CHECK_EQUAL(FixedPointEnergy::from_kcal(-3.4f), -34);
+	BOOST_CHECK_EQUAL(FixedPointEnergy::from_kcal(0.05f), 1);
+	BOOST_CHECK_EQUAL(FixedPointEnergy::from_kcal(N_INFINITY), FixedPointEnergy::infinity());
+	BOOST_CHECK_EQUAL(FixedPointEnergy::from_kcal(-N_INFINITY), -FixedPointEnergy::infinity());
+	BOOST_CHECK_EQUAL(FixedPointEnergy::to_kcal(FixedPointEnergy::infinity()), N_INFINITY);
+	BOOST_CHECK_EQUAL(FixedPointEnergy::to_kcal(-34), -3.4f);
+	
+	compare_with_reference<FixedPointZuker>(settings, settings, thermodynamics, COMPARE_STRUCTURES, [](FixedPointZuker & zuker, Zuker & reference, Sequence & rna)
+	{
+		BOOST_CHECK_SMALL(zuker.energy(0, rna.size()) - reference.energy(0, rna.size()), 0.1f);
+	});
+}
+
+
+/**
+ * @brief Tests whether the specialized engines give exactly the same structures as the generic engine
+ *
+ * @section DESCRIPTION
+ * The engines without segments are compared without any segments
+ * loaded; the engine without SegmentLoops with the default segments,
+ * which contain no SegmentLoops.
+ *
+ * @test
+ */
+BOOST_FIXTURE_TEST_CASE(Test_features, comparison_setup)
+{
+	typedef ZukerEngine<FloatEnergy, ZukerFeatures<false, false> > NoSegmentsZuker;
+	typedef ZukerEngine<FloatEnergy, ZukerFeatures<false, false, ZUKER_CONSTANT_HAIRPIN_LENGTH> > NoSegmentsConstantZuker;
+	typedef ZukerEngine<FloatEnergy, ZukerFeatures<true, false> > SegmentsZuker;
+	typedef ZukerEngine<FloatEnergy, ZukerFeatures<true, false, ZUKER_CONSTANT_HAIRPIN_LENGTH> > SegmentsConstantZuker;
+	
+	BOOST_REQUIRE(!thermodynamics.segments.empty());
+	BOOST_REQUIRE(thermodynamics.segmentloops.empty());
+	
+	compare_with_reference<SegmentsZuker>(settings, settings, thermodynamics, COMPARE_ENERGY | COMPARE_ENERGY_MATRICES | COMPARE_TRACEBACK_MATRICES | COMPARE_STRUCTURES);
+	compare_with_reference<SegmentsConstantZuker>(settings, settings, thermodynamics, COMPARE_ENERGY | COMPARE_ENERGY_MATRICES | COMPARE_TRACEBACK_MATRICES | COMPARE_STRUCTURES);
+	
+	// An engine without segments refuses loaded segments
+	Sequence rna = Sequence(comparison_sequences.back());
+	BOOST_CHECK_THROW((NoSegmentsZuker(settings, rna, thermodynamics)), std::invalid_argument);
+	BOOST_CHECK_THROW((ZukerEngine<FloatEnergy, ZukerFeatures<false, true> >(settings, rna, thermodynamics)), std::invalid_argument);
+	
+	Settings no_segments_settings = settings;
+	no_segments_settings.segment_prediction_functionality = false;
+	ReadData thermodynamics_without_segments = ReadData();
+	
+	compare_with_reference<NoSegmentsZuker>(no_segments_settings, no_segments_settings, thermodynamics_without_segments, COMPARE_ENERGY | COMPARE_ENERGY_MATRICES | COMPARE_TRACEBACK_MATRICES | COMPARE_STRUCTURES);
+	compare_with_reference<NoSegmentsConstantZuker>(no_segments_settings, no_segments_settings, thermodynamics_without_segments, COMPARE_ENERGY | COMPARE_ENERGY_MATRICES | COMPARE_TRACEBACK_MATRICES | COMPARE_STRUCTURES);
+}
+
+
+/**
+ * @brief Tests the maximum base pair span (-L): only the band of the matrices is stored, and W is replaced by the exterior loop
+ *
+ * @section DESCRIPTION
+ * V(i,j) only depends on the pairs within (i,j), so the band of V is
+ * equal to that of the entire matrix. The exterior loop is therefore
+ * compared with the same recursion over the V matrix of an engine
+ * without maximum span; in fixed-point arithmetic that is exact.
+ *
+ * @test
+ */
+BOOST_FIXTURE_TEST_CASE(Test_maximal_pair_span, comparison_setup)
+{
+	size_t max_span = 20;
+	
+	Settings span_settings = settings;
+	span_settings.maximal_pair_span = (unsigned int) max_span;
+	
+	compare_with_reference<FixedPointZuker, FixedPointZuker>(settings, span_settings, thermodynamics, 0, [max_span, &span_settings](FixedPointZuker & zuker, FixedPointZuker & reference, Sequence & rna)
+	{
+		size_t n = rna.size();
+		
+		std::vector<int32_t> exterior = std::vector<int32_t>(n + 1, 0);
+		for(size_t j = 0; j < n; j++)
+		{
+			exterior[j + 1] = exterior[j];
+			for(size_t i = (j > max_span) ? j - max_span : 0; i + span_settings.minimal_hairpin_length < j; i++)
+			{
+				Pair p = Pair((unsigned int) i, (unsigned int) j);
+				exterior[j + 1] = std::min(exterior[j + 1], exterior[i] + reference.vij.get(p));
+			}
+		}
+		
+		BOOST_CHECK_EQUAL(zuker.energy(0, n), FixedPointEnergy::to_kcal(exterior[n]));
+		
+		if(n > max_span + 1)
+		{
+			BOOST_CHECK_EQUAL(zuker.wij.size(), 0);
+			BOOST_CHECK_EQUAL(zuker.tij_w.size(), 0);
+			BOOST_CHECK(zuker.vij.size() < reference.vij.size());
+		}
+		
+		// All pairs span at most max_span
+		zuker.traceback();
+		
+		std::string dotbracket;
+		zuker.dot_bracket.format((unsigned int) n, dotbracket);
+		
+		std::vector<size_t> opened;
+		for(size_t j = 0; j < n; j++)
+		{
+			if(dotbracket[j] == '(')
+			{
+				opened.push_back(j);
+			}
+			else if(dotbracket[j] == ')')
+			{
+				BOOST_REQUIRE(!opened.empty());
+				BOOST_CHECK(j - opened.back() <= max_span);
+				opened.pop_back();
+			}
+		}
+		BOOST_CHECK(opened.empty());
+	});
+	
+	// The traceback by recomputation finds the same structure
+	Settings span_recomputation_settings = span_settings;
+	span_recomputation_settings.traceback_recomputation = true;
+	
+	compare_with_reference<FixedPointZuker, FixedPointZuker>(span_settings, span_recomputation_settings, thermodynamics, COMPARE_ENERGY | COMPARE_STRUCTURES);
+}
+
 ///@todo test function for Zuker::traceback, Zuker::traceback_pop and Zuker::traceback_push
 
 BOOST_AUTO_TEST_SUITE_END()